@@ -55,6 +55,17 @@
 #include <chrono>
 #include <random>
 #include <iomanip>
+#include <functional>
+#include <cstdint>
+#include <iterator>
+#include <thread>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define ARRAY_SIMD_X86 1
+#else
+#define ARRAY_SIMD_X86 0
+#endif
 
 using namespace std;
 using namespace std::chrono;
@@ -397,8 +408,8 @@ void demonstrateSortingAlgorithms() {
         {"Bubble Sort", SortingAlgorithms::bubbleSort},
         {"Selection Sort", SortingAlgorithms::selectionSort},
         {"Insertion Sort", SortingAlgorithms::insertionSort},
-        {"Merge Sort", SortingAlgorithms::mergeSort},
-        {"Quick Sort", SortingAlgorithms::quickSort},
+        {"Merge Sort", static_cast<void (*)(vector<int>&)>(SortingAlgorithms::mergeSort)},
+        {"Quick Sort", static_cast<void (*)(vector<int>&)>(SortingAlgorithms::quickSort)},
         {"Heap Sort", SortingAlgorithms::heapSort},
         {"STL Sort", [](vector<int>& arr) { sort(arr.begin(), arr.end()); }}
     };
@@ -811,6 +822,10 @@ public:
         }
     }
     
+    const vector<long long>& getPrefixArray() const {
+        return prefixSum;
+    }
+    
     // Range sum query O(1)
     long long rangeSum(int left, int right) {
         return prefixSum[right + 1] - prefixSum[left];
@@ -905,6 +920,1535 @@ void demonstratePrefixSum() {
     cout << endl;
 }
 
+/*
+ * ========================================================================
+ * 6. VECTORIZED REDUCTIONS AND SEARCH (SIMD + RUNTIME DISPATCH)
+ * ========================================================================
+ *
+ * The scalar loops in ArrayOperations process one int per iteration and
+ * carry a single dependency chain (maxVal, sum, ...). SIMD versions load
+ * 8 (AVX2) or 16 (AVX-512) ints at once and keep several independent
+ * accumulators so the CPU can overlap loads and ALU work.
+ *
+ * Binary search is limited by memory latency, not by compares:
+ * - Branchless search replaces the unpredictable if/else with a
+ *   conditional move, so there are no pipeline flushes
+ * - Eytzinger (BFS) layout stores the implicit tree level by level so the
+ *   next 4 levels live in one cache line that can be prefetched early
+ * - Batched search advances many queries in lock-step so their cache
+ *   misses are in flight at the same time
+ *
+ * The ISA is detected once at runtime, so a binary compiled with plain
+ * -O2 still uses AVX2/AVX-512 when the machine supports it.
+ */
+
+enum class SimdLevel { Scalar, AVX2, AVX512 };
+
+static const char* simdLevelName(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::AVX512: return "AVX-512";
+        case SimdLevel::AVX2:   return "AVX2";
+        default:                return "Scalar";
+    }
+}
+
+static SimdLevel detectSimdLevel() {
+#if ARRAY_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return SimdLevel::AVX512;
+    if (__builtin_cpu_supports("avx2")) return SimdLevel::AVX2;
+#endif
+    return SimdLevel::Scalar;
+}
+
+class SimdKernels {
+public:
+#if ARRAY_SIMD_X86
+    // ---------------- AVX2: 8 x int32 per register ----------------
+
+    __attribute__((target("avx2")))
+    static long long sumAVX2(const int* data, size_t n) {
+        // Widen to int64 before adding so large arrays cannot overflow
+        __m256i acc0 = _mm256_setzero_si256(), acc1 = _mm256_setzero_si256();
+        __m256i acc2 = _mm256_setzero_si256(), acc3 = _mm256_setzero_si256();
+        size_t i = 0;
+        for (; i + 16 <= n; i += 16) {
+            __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+            __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 8));
+            acc0 = _mm256_add_epi64(acc0, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(a)));
+            acc1 = _mm256_add_epi64(acc1, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(a, 1)));
+            acc2 = _mm256_add_epi64(acc2, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(b)));
+            acc3 = _mm256_add_epi64(acc3, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(b, 1)));
+        }
+        __m256i acc = _mm256_add_epi64(_mm256_add_epi64(acc0, acc1), _mm256_add_epi64(acc2, acc3));
+        alignas(32) long long lanes[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+        long long sum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+        for (; i < n; ++i) sum += data[i];
+        return sum;
+    }
+
+    __attribute__((target("avx2")))
+    static int maxAVX2(const int* data, size_t n) {
+        __m256i m0 = _mm256_set1_epi32(INT_MIN), m1 = m0, m2 = m0, m3 = m0;
+        size_t i = 0;
+        for (; i + 32 <= n; i += 32) {
+            m0 = _mm256_max_epi32(m0, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)));
+            m1 = _mm256_max_epi32(m1, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 8)));
+            m2 = _mm256_max_epi32(m2, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 16)));
+            m3 = _mm256_max_epi32(m3, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 24)));
+        }
+        __m256i m = _mm256_max_epi32(_mm256_max_epi32(m0, m1), _mm256_max_epi32(m2, m3));
+        alignas(32) int lanes[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), m);
+        int result = *max_element(lanes, lanes + 8);
+        for (; i < n; ++i) result = max(result, data[i]);
+        return result;
+    }
+
+    __attribute__((target("avx2")))
+    static int minAVX2(const int* data, size_t n) {
+        __m256i m0 = _mm256_set1_epi32(INT_MAX), m1 = m0, m2 = m0, m3 = m0;
+        size_t i = 0;
+        for (; i + 32 <= n; i += 32) {
+            m0 = _mm256_min_epi32(m0, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)));
+            m1 = _mm256_min_epi32(m1, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 8)));
+            m2 = _mm256_min_epi32(m2, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 16)));
+            m3 = _mm256_min_epi32(m3, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 24)));
+        }
+        __m256i m = _mm256_min_epi32(_mm256_min_epi32(m0, m1), _mm256_min_epi32(m2, m3));
+        alignas(32) int lanes[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), m);
+        int result = *min_element(lanes, lanes + 8);
+        for (; i < n; ++i) result = min(result, data[i]);
+        return result;
+    }
+
+    __attribute__((target("avx2")))
+    static int findFirstAVX2(const int* data, size_t n, int target) {
+        const __m256i needle = _mm256_set1_epi32(target);
+        size_t i = 0;
+        for (; i + 16 <= n; i += 16) {
+            __m256i a = _mm256_cmpeq_epi32(needle, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)));
+            __m256i b = _mm256_cmpeq_epi32(needle, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 8)));
+            // One test for both halves keeps the hot loop to a single branch
+            if (!_mm256_testz_si256(_mm256_or_si256(a, b), _mm256_or_si256(a, b))) {
+                unsigned maskA = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(a)));
+                unsigned maskB = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(b)));
+                unsigned mask = maskA | (maskB << 8);
+                return static_cast<int>(i + __builtin_ctz(mask));
+            }
+        }
+        for (; i < n; ++i) {
+            if (data[i] == target) return static_cast<int>(i);
+        }
+        return -1;
+    }
+
+    // ---------------- AVX-512: 16 x int32 per register ----------------
+    // The unmasked max/min/cvtepi32/extract intrinsics start from an
+    // undefined vector in GCC's headers and trip -Wuninitialized; their
+    // full-mask maskz forms emit the same instructions without it.
+
+    __attribute__((target("avx512f")))
+    static long long sumAVX512(const int* data, size_t n) {
+        __m512i acc0 = _mm512_setzero_si512(), acc1 = _mm512_setzero_si512();
+        __m512i acc2 = _mm512_setzero_si512(), acc3 = _mm512_setzero_si512();
+        size_t i = 0;
+        // Sign-extend straight from memory: 8 x int32 -> 8 x int64 per step
+        for (; i + 32 <= n; i += 32) {
+            const __m256i* p = reinterpret_cast<const __m256i*>(data + i);
+            acc0 = _mm512_add_epi64(acc0, _mm512_maskz_cvtepi32_epi64(0xFF, _mm256_loadu_si256(p)));
+            acc1 = _mm512_add_epi64(acc1, _mm512_maskz_cvtepi32_epi64(0xFF, _mm256_loadu_si256(p + 1)));
+            acc2 = _mm512_add_epi64(acc2, _mm512_maskz_cvtepi32_epi64(0xFF, _mm256_loadu_si256(p + 2)));
+            acc3 = _mm512_add_epi64(acc3, _mm512_maskz_cvtepi32_epi64(0xFF, _mm256_loadu_si256(p + 3)));
+        }
+        alignas(64) long long lanes[8];
+        _mm512_store_si512(lanes, _mm512_add_epi64(_mm512_add_epi64(acc0, acc1), _mm512_add_epi64(acc2, acc3)));
+        long long sum = accumulate(lanes, lanes + 8, 0LL);
+        for (; i < n; ++i) sum += data[i];
+        return sum;
+    }
+
+    __attribute__((target("avx512f")))
+    static int maxAVX512(const int* data, size_t n) {
+        __m512i m0 = _mm512_set1_epi32(INT_MIN), m1 = m0, m2 = m0, m3 = m0;
+        size_t i = 0;
+        for (; i + 64 <= n; i += 64) {
+            m0 = _mm512_maskz_max_epi32(0xFFFF, m0, _mm512_loadu_si512(data + i));
+            m1 = _mm512_maskz_max_epi32(0xFFFF, m1, _mm512_loadu_si512(data + i + 16));
+            m2 = _mm512_maskz_max_epi32(0xFFFF, m2, _mm512_loadu_si512(data + i + 32));
+            m3 = _mm512_maskz_max_epi32(0xFFFF, m3, _mm512_loadu_si512(data + i + 48));
+        }
+        alignas(64) int lanes[16];
+        _mm512_store_si512(lanes, _mm512_maskz_max_epi32(0xFFFF, _mm512_maskz_max_epi32(0xFFFF, m0, m1), _mm512_maskz_max_epi32(0xFFFF, m2, m3)));
+        int result = *max_element(lanes, lanes + 16);
+        for (; i < n; ++i) result = max(result, data[i]);
+        return result;
+    }
+
+    __attribute__((target("avx512f")))
+    static int minAVX512(const int* data, size_t n) {
+        __m512i m0 = _mm512_set1_epi32(INT_MAX), m1 = m0, m2 = m0, m3 = m0;
+        size_t i = 0;
+        for (; i + 64 <= n; i += 64) {
+            m0 = _mm512_maskz_min_epi32(0xFFFF, m0, _mm512_loadu_si512(data + i));
+            m1 = _mm512_maskz_min_epi32(0xFFFF, m1, _mm512_loadu_si512(data + i + 16));
+            m2 = _mm512_maskz_min_epi32(0xFFFF, m2, _mm512_loadu_si512(data + i + 32));
+            m3 = _mm512_maskz_min_epi32(0xFFFF, m3, _mm512_loadu_si512(data + i + 48));
+        }
+        alignas(64) int lanes[16];
+        _mm512_store_si512(lanes, _mm512_maskz_min_epi32(0xFFFF, _mm512_maskz_min_epi32(0xFFFF, m0, m1), _mm512_maskz_min_epi32(0xFFFF, m2, m3)));
+        int result = *min_element(lanes, lanes + 16);
+        for (; i < n; ++i) result = min(result, data[i]);
+        return result;
+    }
+
+    __attribute__((target("avx512f")))
+    static int findFirstAVX512(const int* data, size_t n, int target) {
+        const __m512i needle = _mm512_set1_epi32(target);
+        size_t i = 0;
+        for (; i + 32 <= n; i += 32) {
+            __mmask16 a = _mm512_cmpeq_epi32_mask(needle, _mm512_loadu_si512(data + i));
+            __mmask16 b = _mm512_cmpeq_epi32_mask(needle, _mm512_loadu_si512(data + i + 16));
+            unsigned mask = static_cast<unsigned>(a) | (static_cast<unsigned>(b) << 16);
+            if (mask) return static_cast<int>(i + __builtin_ctz(mask));
+        }
+        // Masked load handles the tail without a scalar loop
+        for (; i < n; i += 16) {
+            __mmask16 valid = static_cast<__mmask16>(n - i >= 16 ? 0xFFFF : (1u << (n - i)) - 1);
+            __m512i v = _mm512_maskz_loadu_epi32(valid, data + i);
+            __mmask16 hit = _mm512_mask_cmpeq_epi32_mask(valid, needle, v);
+            if (hit) return static_cast<int>(i + __builtin_ctz(hit));
+        }
+        return -1;
+    }
+#endif
+};
+
+/*
+ * Dispatcher: resolves each kernel once to a function pointer.
+ * forceLevel() lets the benchmark compare every ISA on the same machine.
+ */
+class VectorizedArrayOps {
+private:
+    using SumFn = long long (*)(const int*, size_t);
+    using ExtremeFn = int (*)(const int*, size_t);
+    using FindFn = int (*)(const int*, size_t, int);
+
+    struct Dispatch {
+        SimdLevel level;
+        SumFn sum;
+        ExtremeFn maximum;
+        ExtremeFn minimum;
+        FindFn findFirst;
+    };
+
+    static long long sumScalar(const int* data, size_t n) {
+        long long sum = 0;
+        for (size_t i = 0; i < n; ++i) sum += data[i];
+        return sum;
+    }
+
+    static int maxScalar(const int* data, size_t n) {
+        int result = INT_MIN;
+        for (size_t i = 0; i < n; ++i) result = max(result, data[i]);
+        return result;
+    }
+
+    static int minScalar(const int* data, size_t n) {
+        int result = INT_MAX;
+        for (size_t i = 0; i < n; ++i) result = min(result, data[i]);
+        return result;
+    }
+
+    static int findFirstScalar(const int* data, size_t n, int target) {
+        for (size_t i = 0; i < n; ++i) {
+            if (data[i] == target) return static_cast<int>(i);
+        }
+        return -1;
+    }
+
+    static Dispatch makeDispatch(SimdLevel level) {
+#if ARRAY_SIMD_X86
+        if (level == SimdLevel::AVX512) {
+            return {level, SimdKernels::sumAVX512, SimdKernels::maxAVX512,
+                    SimdKernels::minAVX512, SimdKernels::findFirstAVX512};
+        }
+        if (level == SimdLevel::AVX2) {
+            return {level, SimdKernels::sumAVX2, SimdKernels::maxAVX2,
+                    SimdKernels::minAVX2, SimdKernels::findFirstAVX2};
+        }
+#endif
+        return {SimdLevel::Scalar, sumScalar, maxScalar, minScalar, findFirstScalar};
+    }
+
+    static Dispatch& current() {
+        static Dispatch dispatch = makeDispatch(detectSimdLevel());
+        return dispatch;
+    }
+
+public:
+    static SimdLevel level() { return current().level; }
+
+    // Never selects an ISA the CPU lacks; falls back to the best supported one
+    static void forceLevel(SimdLevel level) {
+        SimdLevel best = detectSimdLevel();
+        if (static_cast<int>(level) > static_cast<int>(best)) level = best;
+        current() = makeDispatch(level);
+    }
+
+    static long long calculateSum(const vector<int>& arr) {
+        return current().sum(arr.data(), arr.size());
+    }
+
+    static int findMaximum(const vector<int>& arr) {
+        if (arr.empty()) return INT_MIN;
+        return current().maximum(arr.data(), arr.size());
+    }
+
+    static int findMinimum(const vector<int>& arr) {
+        if (arr.empty()) return INT_MAX;
+        return current().minimum(arr.data(), arr.size());
+    }
+
+    // Same contract as ArrayOperations::linearSearch: first index or -1
+    static int linearSearch(const vector<int>& arr, int target) {
+        return current().findFirst(arr.data(), arr.size(), target);
+    }
+};
+
+class FastBinarySearch {
+public:
+    // Branchless lower bound: the loop runs exactly ceil(log2 n) times and
+    // the compare becomes a cmov instead of a mispredicted jump
+    static int binarySearch(const vector<int>& arr, int target) {
+        if (arr.empty()) return -1;
+        const int* base = arr.data();
+        size_t n = arr.size();
+        while (n > 1) {
+            size_t half = n / 2;
+            __builtin_prefetch(base + half / 2);
+            __builtin_prefetch(base + half + half / 2);
+            base = (base[half - 1] < target) ? base + half : base;
+            n -= half;
+        }
+        size_t idx = static_cast<size_t>(base - arr.data()) + (*base < target);
+        return (idx < arr.size() && arr[idx] == target) ? static_cast<int>(idx) : -1;
+    }
+
+    // Batched search: G queries advance one level per round, so up to G
+    // independent cache misses overlap instead of being paid one by one
+    static vector<int> batchedBinarySearch(const vector<int>& arr, const vector<int>& targets) {
+        const size_t G = 16;
+        vector<int> result(targets.size(), -1);
+        if (arr.empty()) return result;
+
+        const int* data = arr.data();
+        for (size_t start = 0; start < targets.size(); start += G) {
+            size_t count = min(G, targets.size() - start);
+            const int* base[G];
+            for (size_t q = 0; q < count; ++q) base[q] = data;
+
+            size_t n = arr.size();
+            while (n > 1) {
+                size_t half = n / 2;
+                for (size_t q = 0; q < count; ++q) {
+                    __builtin_prefetch(base[q] + half / 2);
+                    __builtin_prefetch(base[q] + half + half / 2);
+                }
+                for (size_t q = 0; q < count; ++q) {
+                    base[q] = (base[q][half - 1] < targets[start + q]) ? base[q] + half : base[q];
+                }
+                n -= half;
+            }
+
+            for (size_t q = 0; q < count; ++q) {
+                int target = targets[start + q];
+                size_t idx = static_cast<size_t>(base[q] - data) + (*base[q] < target);
+                if (idx < arr.size() && arr[idx] == target) result[start + q] = static_cast<int>(idx);
+            }
+        }
+        return result;
+    }
+};
+
+/*
+ * Eytzinger layout: node k has children 2k and 2k+1 (1-based), exactly like
+ * a binary heap. Searching walks down with k = 2k + (a[k] < x); the
+ * 16 descendants four levels below k are contiguous, so one prefetch
+ * covers them. Returns the index in the ORIGINAL sorted array.
+ */
+class EytzingerSearch {
+private:
+    vector<int> tree;       // 1-based, tree[0] unused
+    vector<int> sortedIdx;  // tree position -> index in sorted input
+
+    size_t build(const vector<int>& sorted, size_t i, size_t k) {
+        if (k < tree.size()) {
+            i = build(sorted, i, 2 * k);
+            tree[k] = sorted[i];
+            sortedIdx[k] = static_cast<int>(i);
+            ++i;
+            i = build(sorted, i, 2 * k + 1);
+        }
+        return i;
+    }
+
+public:
+    explicit EytzingerSearch(const vector<int>& sorted)
+        : tree(sorted.size() + 1), sortedIdx(sorted.size() + 1, -1) {
+        build(sorted, 0, 1);
+    }
+
+    int search(int target) const {
+        size_t n = tree.size() - 1;
+        size_t k = 1;
+        while (k <= n) {
+            __builtin_prefetch(tree.data() + k * 16);
+            k = 2 * k + (tree[k] < target);
+        }
+        // Undo the trailing right turns plus one left turn to reach the
+        // lower-bound node (ffs finds the lowest zero bit)
+        k >>= __builtin_ffsll(static_cast<long long>(~k));
+        return (k != 0 && tree[k] == target) ? sortedIdx[k] : -1;
+    }
+};
+
+void demonstrateVectorizedOperations() {
+    cout << "6. VECTORIZED REDUCTIONS AND SEARCH" << endl;
+    cout << "====================================" << endl;
+
+    SimdLevel detected = detectSimdLevel();
+    cout << "Detected SIMD level: " << simdLevelName(detected) << endl;
+
+    // Correctness check against the scalar ArrayOperations versions
+    vector<int> small;
+    ArrayOperations::initializeArray(small, 1003, -1000, 1000);
+    int needle = small[777];
+    cout << "\nCorrectness vs ArrayOperations (n = 1003):" << endl;
+    for (SimdLevel level : {SimdLevel::Scalar, SimdLevel::AVX2, SimdLevel::AVX512}) {
+        if (static_cast<int>(level) > static_cast<int>(detected)) continue;
+        VectorizedArrayOps::forceLevel(level);
+        bool ok = VectorizedArrayOps::calculateSum(small) == ArrayOperations::calculateSum(small) &&
+                  VectorizedArrayOps::findMaximum(small) == ArrayOperations::findMaximum(small) &&
+                  VectorizedArrayOps::findMinimum(small) == ArrayOperations::findMinimum(small) &&
+                  VectorizedArrayOps::linearSearch(small, needle) == ArrayOperations::linearSearch(small, needle) &&
+                  VectorizedArrayOps::linearSearch(small, 5000) == -1;
+        cout << setw(8) << simdLevelName(level) << ": " << (ok ? "✓" : "✗") << endl;
+    }
+
+    // Throughput benchmark in GB/s
+    const size_t N = 1 << 22;  // 16 MB of ints
+    const int REPS = 10;
+    vector<int> big;
+    ArrayOperations::initializeArray(big, static_cast<int>(N), -1000000, 1000000);
+    big[N - 1] = 2000000;  // Unique value at the end: worst case for find
+    double bytes = static_cast<double>(N) * sizeof(int) * REPS;
+
+    auto gbps = [&](auto&& fn) {
+        auto start = high_resolution_clock::now();
+        long long sink = 0;
+        for (int r = 0; r < REPS; ++r) sink += fn();
+        auto secs = duration<double>(high_resolution_clock::now() - start).count();
+        if (sink == 42) cout << "";  // Keep the result alive
+        return bytes / secs / 1e9;
+    };
+
+    cout << "\nThroughput over " << N << " ints (GB/s):" << endl;
+    cout << setw(10) << "ISA" << setw(10) << "sum" << setw(10) << "max"
+         << setw(10) << "min" << setw(10) << "find" << endl;
+    cout << fixed << setprecision(2);
+    for (SimdLevel level : {SimdLevel::Scalar, SimdLevel::AVX2, SimdLevel::AVX512}) {
+        if (static_cast<int>(level) > static_cast<int>(detected)) continue;
+        VectorizedArrayOps::forceLevel(level);
+        cout << setw(10) << simdLevelName(level)
+             << setw(10) << gbps([&] { return VectorizedArrayOps::calculateSum(big); })
+             << setw(10) << gbps([&] { return (long long)VectorizedArrayOps::findMaximum(big); })
+             << setw(10) << gbps([&] { return (long long)VectorizedArrayOps::findMinimum(big); })
+             << setw(10) << gbps([&] { return (long long)VectorizedArrayOps::linearSearch(big, 2000000); })
+             << endl;
+    }
+    VectorizedArrayOps::forceLevel(detected);
+
+    // Binary search variants on a sorted array of distinct values
+    vector<int> sorted(N);
+    for (size_t i = 0; i < N; ++i) sorted[i] = static_cast<int>(2 * i);
+    vector<int> queries;
+    ArrayOperations::initializeArray(queries, 1 << 20, 0, static_cast<int>(2 * N));
+    EytzingerSearch eytzinger(sorted);
+
+    bool agree = true;
+    vector<int> batched = FastBinarySearch::batchedBinarySearch(sorted, queries);
+    for (size_t i = 0; i < 1000; ++i) {
+        int expected = ArrayOperations::binarySearch(sorted, queries[i]);
+        agree &= FastBinarySearch::binarySearch(sorted, queries[i]) == expected &&
+                 eytzinger.search(queries[i]) == expected && batched[i] == expected;
+    }
+    cout << "\nBinary search variants agree: " << (agree ? "✓" : "✗") << endl;
+
+    auto mqps = [&](auto&& fn) {
+        auto start = high_resolution_clock::now();
+        long long sink = fn();
+        auto secs = duration<double>(high_resolution_clock::now() - start).count();
+        if (sink == 42) cout << "";
+        return queries.size() / secs / 1e6;
+    };
+    cout << "Lookups over " << N << " sorted ints (million queries/s):" << endl;
+    cout << "  Classic:     " << mqps([&] {
+        long long s = 0;
+        for (int q : queries) s += ArrayOperations::binarySearch(sorted, q);
+        return s;
+    }) << endl;
+    cout << "  Branchless:  " << mqps([&] {
+        long long s = 0;
+        for (int q : queries) s += FastBinarySearch::binarySearch(sorted, q);
+        return s;
+    }) << endl;
+    cout << "  Eytzinger:   " << mqps([&] {
+        long long s = 0;
+        for (int q : queries) s += eytzinger.search(q);
+        return s;
+    }) << endl;
+    cout << "  Batched x16: " << mqps([&] {
+        auto r = FastBinarySearch::batchedBinarySearch(sorted, queries);
+        return accumulate(r.begin(), r.end(), 0LL);
+    }) << endl;
+    cout << defaultfloat << setprecision(6);
+
+    cout << endl;
+}
+
+/*
+ * ========================================================================
+ * 7. PARALLEL PREFIX SCANS (BLOCKED TWO-PASS + SIMD IN-REGISTER SCAN)
+ * ========================================================================
+ *
+ * A scan looks inherently serial (out[i] needs out[i-1]) but any
+ * associative operator can be split into blocks:
+ *
+ *   Pass 1: each thread reduces its own block        -> blockTotal[b]
+ *   Serial: exclusive scan of the few block totals    -> blockOffset[b]
+ *   Pass 2: each thread scans its block seeded with blockOffset[b]
+ *
+ * Work is ~2n, depth is O(n/p + p). Inside a block the sum scan runs in
+ * AVX2 registers: x += shift(x, 1); x += shift(x, 2) produces 4 prefix
+ * sums with two adds.
+ *
+ * Results are bit-identical to the serial loops because only integer
+ * (wrapping) arithmetic is used - reassociating floating point would not
+ * be exact. Compile with -pthread.
+ */
+
+class ParallelScan {
+public:
+    static unsigned defaultThreads(size_t n) {
+        const size_t GRAIN = 1 << 15;  // Below this a thread costs more than it saves
+        unsigned hw = max(1u, thread::hardware_concurrency());
+        return static_cast<unsigned>(max<size_t>(1, min<size_t>(hw, n / GRAIN)));
+    }
+
+    // Run fn(blockIndex, begin, end) for each of `blocks` equal ranges
+    template <typename Fn>
+    static void forEachBlock(size_t n, unsigned blocks, Fn fn) {
+        vector<thread> workers;
+        for (unsigned b = 1; b < blocks; ++b) {
+            workers.emplace_back(fn, b, n * b / blocks, n * (b + 1) / blocks);
+        }
+        fn(0u, size_t(0), n / blocks);  // The calling thread takes block 0
+        for (auto& w : workers) w.join();
+    }
+
+    // out[i] = in[0] op ... op in[i]; `in` and `out` may alias
+    template <typename In, typename Out, typename Op>
+    static void inclusiveScan(const In* in, Out* out, size_t n, Op op, Out identity,
+                              unsigned threads = 0) {
+        scanImpl(in, out, n, op, identity, threads, false);
+    }
+
+    // out[i] = in[0] op ... op in[i-1], out[0] = identity
+    template <typename In, typename Out, typename Op>
+    static void exclusiveScan(const In* in, Out* out, size_t n, Op op, Out identity,
+                              unsigned threads = 0) {
+        scanImpl(in, out, n, op, identity, threads, true);
+    }
+
+    // Prefix sums with the PrefixSum layout: result[0] = 0, result[i+1] = sum(arr[0..i])
+    static vector<long long> prefixSums(const vector<int>& arr, unsigned threads = 0) {
+        vector<long long> result(arr.size() + 1, 0);
+        size_t n = arr.size();
+        if (threads == 0) threads = defaultThreads(n);
+
+        vector<long long> blockTotal(threads, 0);
+        forEachBlock(n, threads, [&](unsigned b, size_t begin, size_t end) {
+            long long sum = 0;
+            for (size_t i = begin; i < end; ++i) sum += arr[i];
+            blockTotal[b] = sum;
+        });
+        long long carry = 0;
+        for (unsigned b = 0; b < threads; ++b) {
+            long long total = blockTotal[b];
+            blockTotal[b] = carry;
+            carry += total;
+        }
+        forEachBlock(n, threads, [&](unsigned b, size_t begin, size_t end) {
+            sumScanBlock(arr.data() + begin, result.data() + begin + 1, end - begin, blockTotal[b]);
+        });
+        return result;
+    }
+
+    /*
+     * Segmented inclusive sum: the running sum restarts wherever
+     * headFlags[i] != 0. The pair operator
+     *   (f1, v1) + (f2, v2) = (f1 | f2, f2 ? v2 : v1 + v2)
+     * is associative, so the same two-pass scheme applies: a block's carry
+     * only reaches the elements before its first segment head.
+     */
+    static vector<long long> segmentedInclusiveSum(const vector<int>& values,
+                                                   const vector<unsigned char>& headFlags,
+                                                   unsigned threads = 0) {
+        size_t n = values.size();
+        vector<long long> result(n);
+        if (threads == 0) threads = defaultThreads(n);
+
+        vector<long long> blockSum(threads, 0);
+        vector<unsigned char> blockHasHead(threads, 0);
+        forEachBlock(n, threads, [&](unsigned b, size_t begin, size_t end) {
+            long long sum = 0;
+            unsigned char hasHead = 0;
+            for (size_t i = begin; i < end; ++i) {
+                if (headFlags[i]) { sum = 0; hasHead = 1; }
+                sum += values[i];
+            }
+            blockSum[b] = sum;
+            blockHasHead[b] = hasHead;
+        });
+
+        vector<long long> carryIn(threads, 0);
+        long long carry = 0;
+        for (unsigned b = 0; b < threads; ++b) {
+            carryIn[b] = carry;
+            carry = blockHasHead[b] ? blockSum[b] : carry + blockSum[b];
+        }
+
+        forEachBlock(n, threads, [&](unsigned b, size_t begin, size_t end) {
+            long long sum = carryIn[b];
+            for (size_t i = begin; i < end; ++i) {
+                if (headFlags[i]) sum = 0;
+                sum += values[i];
+                result[i] = sum;
+            }
+        });
+        return result;
+    }
+
+    /*
+     * Parallel product of array except self: an exclusive product scan
+     * from the left times one from the right. Products are computed in
+     * unsigned arithmetic, which wraps exactly like the serial int loop on
+     * two's complement hardware without the signed-overflow UB.
+     */
+    static vector<int> productExceptSelf(const vector<int>& arr, unsigned threads = 0) {
+        size_t n = arr.size();
+        auto mul = [](unsigned a, unsigned b) { return a * b; };
+        vector<unsigned> left(n), right(n);
+        vector<unsigned> reversed(arr.rbegin(), arr.rend());
+
+        exclusiveScan(arr.data(), left.data(), n, mul, 1u, threads);
+        exclusiveScan(reversed.data(), right.data(), n, mul, 1u, threads);
+
+        vector<int> result(n);
+        for (size_t i = 0; i < n; ++i) {
+            result[i] = static_cast<int>(left[i] * right[n - 1 - i]);
+        }
+        return result;
+    }
+
+    /*
+     * Parallel "subarray sum equals k": count pairs i < j with
+     * P[j] - P[i] == k over the prefix array P (P[0] = 0).
+     * Pass 1: each block counts its inner pairs and tallies, per distinct
+     * value, the prefixes it holds and the prefixes it wants (P[j] - k),
+     * split into one shard per thread by value.
+     * Pass 2: each thread sweeps the blocks in order over its own shard,
+     * matching a block's wants against the running tally of all earlier
+     * blocks, then adding the block's own prefixes to it. Every prefix is
+     * probed O(1) times in total, whatever the number of blocks.
+     */
+    static long long subarraySum(const vector<int>& arr, int k, unsigned threads = 0) {
+        // Wrapping int prefixes reproduce PrefixSum::subarraySum's arithmetic
+        vector<int> prefix(arr.size() + 1, 0);
+        auto add = [](int a, int b) {
+            return static_cast<int>(static_cast<unsigned>(a) + static_cast<unsigned>(b));
+        };
+        inclusiveScan(arr.data(), prefix.data() + 1, arr.size(), add, 0, threads);
+
+        size_t n = prefix.size();
+        if (threads == 0) threads = defaultThreads(n);
+        auto shardOf = [threads](int value) {
+            uint32_t h = static_cast<uint32_t>(value) * 2654435761u;
+            return static_cast<unsigned>((static_cast<uint64_t>(h) * threads) >> 32);
+        };
+
+        using Tally = unordered_map<int, long long>;
+        vector<vector<Tally>> have(threads, vector<Tally>(threads));
+        vector<vector<Tally>> want(threads, vector<Tally>(threads));
+        vector<long long> pairs(threads, 0);
+        forEachBlock(n, threads, [&](unsigned b, size_t begin, size_t end) {
+            Tally seen;
+            long long count = 0;
+            for (size_t j = begin; j < end; ++j) {
+                int wanted = add(prefix[j], -k);
+                auto it = seen.find(wanted);
+                if (it != seen.end()) count += it->second;
+                seen[prefix[j]]++;
+                want[b][shardOf(wanted)][wanted]++;
+            }
+            for (const auto& [value, times] : seen) have[b][shardOf(value)][value] += times;
+            pairs[b] = count;
+        });
+
+        vector<long long> shardPairs(threads, 0);
+        forEachBlock(threads, threads, [&](unsigned s, size_t, size_t) {
+            Tally earlier;
+            long long count = 0;
+            for (unsigned b = 0; b < threads; ++b) {
+                for (const auto& [value, times] : want[b][s]) {
+                    auto it = earlier.find(value);
+                    if (it != earlier.end()) count += times * it->second;
+                }
+                for (const auto& [value, times] : have[b][s]) earlier[value] += times;
+            }
+            shardPairs[s] = count;
+        });
+        return accumulate(pairs.begin(), pairs.end(), 0LL) +
+               accumulate(shardPairs.begin(), shardPairs.end(), 0LL);
+    }
+
+private:
+    template <typename In, typename Out, typename Op>
+    static void scanImpl(const In* in, Out* out, size_t n, Op op, Out identity,
+                         unsigned threads, bool exclusive) {
+        if (threads == 0) threads = defaultThreads(n);
+
+        vector<Out> blockTotal(threads, identity);
+        forEachBlock(n, threads, [&](unsigned b, size_t begin, size_t end) {
+            Out acc = identity;
+            for (size_t i = begin; i < end; ++i) acc = op(acc, static_cast<Out>(in[i]));
+            blockTotal[b] = acc;
+        });
+
+        Out carry = identity;
+        for (unsigned b = 0; b < threads; ++b) {
+            Out total = blockTotal[b];
+            blockTotal[b] = carry;
+            carry = op(carry, total);
+        }
+
+        forEachBlock(n, threads, [&](unsigned b, size_t begin, size_t end) {
+            Out acc = blockTotal[b];
+            for (size_t i = begin; i < end; ++i) {
+                Out value = static_cast<Out>(in[i]);  // Read before a possible aliased write
+                if (exclusive) {
+                    out[i] = acc;
+                    acc = op(acc, value);
+                } else {
+                    acc = op(acc, value);
+                    out[i] = acc;
+                }
+            }
+        });
+    }
+
+    static void sumScanBlock(const int* in, long long* out, size_t n, long long carry) {
+#if ARRAY_SIMD_X86
+        if (VectorizedArrayOps::level() != SimdLevel::Scalar) {
+            sumScanBlockAVX2(in, out, n, carry);
+            return;
+        }
+#endif
+        for (size_t i = 0; i < n; ++i) {
+            carry += in[i];
+            out[i] = carry;
+        }
+    }
+
+#if ARRAY_SIMD_X86
+    __attribute__((target("avx2")))
+    static void sumScanBlockAVX2(const int* in, long long* out, size_t n, long long carry) {
+        __m256i running = _mm256_set1_epi64x(carry);
+        const __m256i zero = _mm256_setzero_si256();
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4) {
+            __m256i x = _mm256_cvtepi32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i)));
+            // [a b c d] + [0 a b c] -> [a, a+b, b+c, c+d]
+            x = _mm256_add_epi64(x, _mm256_blend_epi32(_mm256_permute4x64_epi64(x, _MM_SHUFFLE(2, 1, 0, 0)), zero, 0x03));
+            // + [0 0 a a+b] -> [a, a+b, a+b+c, a+b+c+d]
+            x = _mm256_add_epi64(x, _mm256_blend_epi32(_mm256_permute4x64_epi64(x, _MM_SHUFFLE(1, 0, 0, 0)), zero, 0x0F));
+            x = _mm256_add_epi64(x, running);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), x);
+            running = _mm256_permute4x64_epi64(x, _MM_SHUFFLE(3, 3, 3, 3));
+        }
+        carry = _mm256_extract_epi64(running, 0);
+        for (; i < n; ++i) {
+            carry += in[i];
+            out[i] = carry;
+        }
+    }
+#endif
+};
+
+void demonstrateParallelScans() {
+    cout << "7. PARALLEL PREFIX SCANS" << endl;
+    cout << "========================" << endl;
+
+    vector<int> arr = {3, 1, 4, 1, 5, 9, 2, 6};
+    ArrayOperations::displayArray(arr, "Array");
+
+    vector<int> inclusive(arr.size()), exclusive(arr.size());
+    auto plus = [](int a, int b) { return a + b; };
+    ParallelScan::inclusiveScan(arr.data(), inclusive.data(), arr.size(), plus, 0, 3);
+    ParallelScan::exclusiveScan(arr.data(), exclusive.data(), arr.size(), plus, 0, 3);
+    ArrayOperations::displayArray(inclusive, "Inclusive scan");
+    ArrayOperations::displayArray(exclusive, "Exclusive scan");
+
+    vector<unsigned char> heads = {1, 0, 0, 1, 0, 1, 0, 0};
+    auto segmented = ParallelScan::segmentedInclusiveSum(arr, heads, 3);
+    cout << "Segmented sum (heads at 0, 3, 5): [";
+    for (size_t i = 0; i < segmented.size(); ++i) {
+        cout << segmented[i] << (i + 1 < segmented.size() ? ", " : "");
+    }
+    cout << "]" << endl;
+
+    // Bit-identical check against the serial implementations
+    vector<int> big;
+    ArrayOperations::initializeArray(big, 1 << 21, -50, 50);
+    vector<int> smallValues;
+    ArrayOperations::initializeArray(smallValues, 50000, -3, 3);
+
+    // Products stay in int range: +-1 everywhere and +-2 at 20 spots, then
+    // the same with exactly one zero and with two zeros
+    vector<int> units;
+    ArrayOperations::initializeArray(units, 50000, 0, 1);
+    for (int& v : units) v = v ? 1 : -1;
+    for (size_t i = 0; i < 20; ++i) units[i * 2477] *= 2;
+    vector<int> oneZero = units, twoZeros = units;
+    oneZero[12345] = 0;
+    twoZeros[12345] = twoZeros[40000] = 0;
+
+    PrefixSum serial(big);
+    bool same = true;
+    for (unsigned threads : {1u, 2u, 3u, 8u}) {
+        auto parallel = ParallelScan::prefixSums(big, threads);
+        same &= parallel == serial.getPrefixArray();
+        for (const auto* values : {&units, &oneZero, &twoZeros}) {
+            same &= ParallelScan::productExceptSelf(*values, threads) == PrefixSum::productExceptSelf(*values);
+        }
+        same &= ParallelScan::subarraySum(smallValues, 2, threads) == PrefixSum::subarraySum(smallValues, 2);
+    }
+    cout << "\nParallel == serial (prefix sums, product except self, subarray count): "
+         << (same ? "✓" : "✗") << endl;
+
+    // Scaling benchmark
+    cout << "\nPrefix-sum scaling over " << big.size() << " ints (hardware threads: "
+         << thread::hardware_concurrency() << "):" << endl;
+    // Best of 3 runs so page-fault and frequency warm-up do not skew the numbers
+    auto bestMs = [](auto&& fn) {
+        double best = 1e18;
+        for (int rep = 0; rep < 3; ++rep) {
+            auto start = high_resolution_clock::now();
+            fn();
+            best = min(best, duration<double, milli>(high_resolution_clock::now() - start).count());
+        }
+        return best;
+    };
+    double serialMs = bestMs([&] { PrefixSum baseline(big); });
+    cout << "  Serial PrefixSum: " << fixed << setprecision(2) << serialMs << " ms" << endl;
+    for (unsigned threads : {1u, 2u, 4u, 8u}) {
+        double ms = bestMs([&] { ParallelScan::prefixSums(big, threads); });
+        cout << "  " << threads << " thread(s):      " << ms << " ms (speedup "
+             << serialMs / ms << "x)" << endl;
+    }
+    cout << defaultfloat << setprecision(6);
+
+    cout << endl;
+}
+
+/*
+ * ========================================================================
+ * 8. SORTED SET KERNELS (SIMD INTERSECTION, GALLOPING, UNION, DIFFERENCE)
+ * ========================================================================
+ *
+ * Inverted indexes store posting lists as strictly increasing uint32_t
+ * IDs; queries intersect/union them. The textbook two-pointer merge
+ * compares one pair per step and mispredicts about half its branches.
+ *
+ * - Branchless merge: advance both cursors by comparison results.
+ * - SIMD 4x4: load 4 IDs from each list, compare every pair with 4 lane
+ *   rotations, and pack the matches with one byte shuffle.
+ * - Galloping: when one list is much shorter, exponential-search each
+ *   of its IDs in the longer list: O(m log(n/m)) instead of O(n + m).
+ */
+
+class SortedSetKernels {
+public:
+    static vector<uint32_t> intersectScalar(const vector<uint32_t>& a, const vector<uint32_t>& b) {
+        vector<uint32_t> out(min(a.size(), b.size()));
+        size_t i = 0, j = 0, k = 0;
+        while (i < a.size() && j < b.size()) {
+            uint32_t x = a[i], y = b[j];
+            out[k] = x;
+            k += (x == y);
+            i += (x <= y);
+            j += (y <= x);
+        }
+        out.resize(k);
+        return out;
+    }
+
+    static vector<uint32_t> intersectGalloping(const vector<uint32_t>& small, const vector<uint32_t>& large) {
+        vector<uint32_t> out;
+        out.reserve(small.size());
+        size_t lo = 0;
+        for (uint32_t x : small) {
+            // Exponential probe from the last position, then binary search the bracket
+            size_t step = 1, hi = lo;
+            while (hi < large.size() && large[hi] < x) {
+                lo = hi + 1;
+                hi += step;
+                step <<= 1;
+            }
+            hi = min(hi, large.size());
+            lo = static_cast<size_t>(lower_bound(large.begin() + lo, large.begin() + hi, x) - large.begin());
+            if (lo == large.size()) break;
+            if (large[lo] == x) out.push_back(x);
+        }
+        return out;
+    }
+
+    static vector<uint32_t> intersectSIMD(const vector<uint32_t>& a, const vector<uint32_t>& b) {
+#if ARRAY_SIMD_X86
+        static const bool hasSSSE3 = __builtin_cpu_supports("ssse3");
+        if (hasSSSE3) return intersectSSSE3(a, b);
+#endif
+        return intersectScalar(a, b);
+    }
+
+    // Picks galloping for skewed sizes, SIMD otherwise
+    static vector<uint32_t> intersect(const vector<uint32_t>& a, const vector<uint32_t>& b) {
+        const vector<uint32_t>& small = a.size() <= b.size() ? a : b;
+        const vector<uint32_t>& large = a.size() <= b.size() ? b : a;
+        if (small.size() * 32 < large.size()) return intersectGalloping(small, large);
+        return intersectSIMD(a, b);
+    }
+
+    static vector<uint32_t> unite(const vector<uint32_t>& a, const vector<uint32_t>& b) {
+        vector<uint32_t> out(a.size() + b.size());
+        size_t i = 0, j = 0, k = 0;
+        while (i < a.size() && j < b.size()) {
+            uint32_t x = a[i], y = b[j];
+            out[k++] = x < y ? x : y;
+            i += (x <= y);
+            j += (y <= x);
+        }
+        while (i < a.size()) out[k++] = a[i++];
+        while (j < b.size()) out[k++] = b[j++];
+        out.resize(k);
+        return out;
+    }
+
+    // a \ b
+    static vector<uint32_t> difference(const vector<uint32_t>& a, const vector<uint32_t>& b) {
+        vector<uint32_t> out(a.size());
+        size_t i = 0, j = 0, k = 0;
+        while (i < a.size() && j < b.size()) {
+            uint32_t x = a[i], y = b[j];
+            out[k] = x;
+            k += (x < y);
+            i += (x <= y);
+            j += (y <= x);
+        }
+        while (i < a.size()) out[k++] = a[i++];
+        out.resize(k);
+        return out;
+    }
+
+private:
+#if ARRAY_SIMD_X86
+    // pshufb control that packs the 32-bit lanes selected by a 4-bit mask to the front
+    struct PackTable {
+        alignas(16) uint8_t control[16][16];
+        PackTable() {
+            for (int mask = 0; mask < 16; ++mask) {
+                int out = 0;
+                for (int lane = 0; lane < 4; ++lane) {
+                    if (mask & (1 << lane)) {
+                        for (int byte = 0; byte < 4; ++byte) control[mask][out * 4 + byte] = static_cast<uint8_t>(lane * 4 + byte);
+                        ++out;
+                    }
+                }
+                for (int byte = out * 4; byte < 16; ++byte) control[mask][byte] = 0x80;
+            }
+        }
+    };
+
+    __attribute__((target("ssse3")))
+    static vector<uint32_t> intersectSSSE3(const vector<uint32_t>& a, const vector<uint32_t>& b) {
+        static const PackTable table;
+        // Every 16-byte store may spill 3 lanes past the count
+        vector<uint32_t> out(min(a.size(), b.size()) + 4);
+        size_t i = 0, j = 0, k = 0;
+        while (i + 4 <= a.size() && j + 4 <= b.size()) {
+            __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a.data() + i));
+            __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b.data() + j));
+            __m128i hit = _mm_or_si128(
+                _mm_or_si128(_mm_cmpeq_epi32(va, vb),
+                             _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(0, 3, 2, 1)))),
+                _mm_or_si128(_mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(1, 0, 3, 2))),
+                             _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(2, 1, 0, 3)))));
+            int mask = _mm_movemask_ps(_mm_castsi128_ps(hit));
+            __m128i packed = _mm_shuffle_epi8(va, _mm_load_si128(reinterpret_cast<const __m128i*>(table.control[mask])));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out.data() + k), packed);
+            k += __builtin_popcount(mask);
+
+            uint32_t aMax = a[i + 3], bMax = b[j + 3];
+            i += (aMax <= bMax) * 4;
+            j += (bMax <= aMax) * 4;
+        }
+        while (i < a.size() && j < b.size()) {
+            uint32_t x = a[i], y = b[j];
+            out[k] = x;
+            k += (x == y);
+            i += (x <= y);
+            j += (y <= x);
+        }
+        out.resize(k);
+        return out;
+    }
+#endif
+};
+
+void demonstrateSortedSetKernels() {
+    cout << "8. SORTED SET KERNELS" << endl;
+    cout << "=====================" << endl;
+
+    vector<uint32_t> a = {1, 3, 4, 7, 9, 12, 15, 18, 21, 30};
+    vector<uint32_t> b = {2, 3, 7, 8, 9, 15, 16, 21, 22};
+    auto show = [](const vector<uint32_t>& v, const string& label) {
+        cout << label << ": [";
+        for (size_t i = 0; i < v.size(); ++i) cout << v[i] << (i + 1 < v.size() ? ", " : "");
+        cout << "]" << endl;
+    };
+    show(SortedSetKernels::intersectSIMD(a, b), "A ∩ B");
+    show(SortedSetKernels::unite(a, b), "A ∪ B");
+    show(SortedSetKernels::difference(a, b), "A \\ B");
+
+    // Random strictly increasing ID lists drawn from [0, universe)
+    mt19937 gen(7);
+    auto makeList = [&](size_t count, uint32_t universe) {
+        vector<uint32_t> ids(count);
+        for (auto& id : ids) id = gen() % universe;
+        sort(ids.begin(), ids.end());
+        ids.erase(unique(ids.begin(), ids.end()), ids.end());
+        return ids;
+    };
+
+    const size_t LARGE = 1 << 22;
+    vector<uint32_t> large = makeList(LARGE, 1u << 25);
+    cout << "\nIntersection of " << large.size() << " IDs with a smaller list (ms):" << endl;
+    cout << setw(8) << "ratio" << setw(10) << "std" << setw(10) << "scalar" << setw(10) << "SIMD"
+         << setw(10) << "gallop" << setw(10) << "auto" << endl;
+    for (size_t ratio : {1, 10, 100, 1000}) {
+        vector<uint32_t> small = makeList(LARGE / ratio, 1u << 25);
+        vector<uint32_t> expected;
+        set_intersection(small.begin(), small.end(), large.begin(), large.end(), back_inserter(expected));
+
+        bool ok = true;
+        auto ms = [&](auto&& fn) {
+            auto start = high_resolution_clock::now();
+            vector<uint32_t> got = fn();
+            double elapsed = duration<double, milli>(high_resolution_clock::now() - start).count();
+            ok = ok && got == expected;
+            return elapsed;
+        };
+        cout << fixed << setprecision(2) << setw(7) << ratio << "x"
+             << setw(10) << ms([&] {
+                    vector<uint32_t> r;
+                    set_intersection(small.begin(), small.end(), large.begin(), large.end(), back_inserter(r));
+                    return r;
+                })
+             << setw(10) << ms([&] { return SortedSetKernels::intersectScalar(small, large); })
+             << setw(10) << ms([&] { return SortedSetKernels::intersectSIMD(small, large); })
+             << setw(10) << ms([&] { return SortedSetKernels::intersectGalloping(small, large); })
+             << setw(10) << ms([&] { return SortedSetKernels::intersect(small, large); })
+             << (ok ? "" : "  MISMATCH") << endl;
+    }
+    cout << defaultfloat << setprecision(6);
+
+    cout << endl;
+}
+
+/*
+ * ========================================================================
+ * 9. COMPRESSED INTEGER ARRAYS (DELTA BIT-PACKING, ROARING BITMAP)
+ * ========================================================================
+ *
+ * A sorted list of IDs in a vector costs 4 bytes per ID, even though
+ * neighbouring IDs usually differ by a few bits.
+ *
+ * PackedIdArray (frame-of-reference + delta, SIMD-BP128 layout):
+ * - IDs are cut into blocks of 128. Each block stores its first ID and
+ *   the stride-8 deltas v[i] - v[i-8], packed at the block's max width.
+ * - Deltas are interleaved across 8 lanes, so AVX2 unpacks 8 of them
+ *   per shift/mask step, and the prefix sum is a single vector add per
+ *   row instead of a serial scan.
+ * - Random access decodes one block: locate it with a binary search on
+ *   the block first-IDs, then unpack 128 values.
+ *
+ * RoaringBitmap:
+ * - Splits each ID into a 16-bit key and a 16-bit low part.
+ * - Each key owns a container: a sorted uint16_t array while it has at
+ *   most 4096 members, and a 65536-bit bitmap beyond that (8 KB, which
+ *   is where the array would become larger).
+ * - Set operations dispatch per container pair (array/array merge,
+ *   bitmap/bitmap word AND/OR, array/bitmap probe).
+ */
+
+class PackedIdArray {
+public:
+    static constexpr size_t BLOCK = 128;
+    static constexpr size_t LANES = 8;
+    static constexpr size_t ROWS = BLOCK / LANES;
+
+    PackedIdArray() = default;
+
+    // ids must be sorted in non-decreasing order
+    explicit PackedIdArray(const vector<uint32_t>& ids) : count(ids.size()) {
+        size_t blocks = (count + BLOCK - 1) / BLOCK;
+        firsts.reserve(blocks);
+        widths.reserve(blocks);
+        offsets.reserve(blocks + 1);
+        uint32_t deltas[BLOCK];
+        for (size_t start = 0; start < count; start += BLOCK) {
+            size_t len = min(BLOCK, count - start);
+            const uint32_t* v = ids.data() + start;
+            // Pad the short final block by repeating its last ID (zero deltas)
+            auto at = [&](size_t i) { return v[min(i, len - 1)]; };
+            uint32_t used = 0;
+            for (size_t i = 0; i < BLOCK; ++i) {
+                deltas[i] = at(i) - (i < LANES ? v[0] : at(i - LANES));
+                used |= deltas[i];
+            }
+            uint32_t width = used ? 32 - __builtin_clz(used) : 0;
+            firsts.push_back(v[0]);
+            widths.push_back(static_cast<uint8_t>(width));
+            offsets.push_back(words.size());
+            pack(deltas, width);
+        }
+        offsets.push_back(words.size());
+    }
+
+    size_t size() const { return count; }
+    size_t blockCount() const { return firsts.size(); }
+    size_t bytes() const {
+        return words.size() * sizeof(uint32_t) + firsts.size() * (sizeof(uint32_t) + sizeof(uint8_t) + sizeof(size_t));
+    }
+
+    // Writes the block's (up to) 128 IDs to out, which must hold BLOCK values
+    size_t decodeBlock(size_t block, uint32_t* out) const {
+        const uint32_t* in = words.data() + offsets[block];
+#if ARRAY_SIMD_X86
+        static const bool hasAVX2 = detectSimdLevel() != SimdLevel::Scalar;
+        if (hasAVX2) unpackAVX2(in, widths[block], firsts[block], out);
+        else
+#endif
+            unpackScalar(in, widths[block], firsts[block], out);
+        return min(BLOCK, count - block * BLOCK);
+    }
+
+    uint32_t operator[](size_t i) const {
+        uint32_t buffer[BLOCK];
+        decodeBlock(i / BLOCK, buffer);
+        return buffer[i % BLOCK];
+    }
+
+    template <typename Fn>
+    void forEach(Fn&& fn) const {
+        uint32_t buffer[BLOCK];
+        for (size_t b = 0; b < firsts.size(); ++b) {
+            size_t len = decodeBlock(b, buffer);
+            for (size_t i = 0; i < len; ++i) fn(buffer[i]);
+        }
+    }
+
+    vector<uint32_t> decode() const {
+        vector<uint32_t> out(firsts.size() * BLOCK);
+        for (size_t b = 0; b < firsts.size(); ++b) decodeBlock(b, out.data() + b * BLOCK);
+        out.resize(count);
+        return out;
+    }
+
+    bool contains(uint32_t id) const {
+        auto it = upper_bound(firsts.begin(), firsts.end(), id);
+        if (it == firsts.begin()) return false;
+        uint32_t buffer[BLOCK];
+        size_t len = decodeBlock(static_cast<size_t>(it - firsts.begin()) - 1, buffer);
+        return binary_search(buffer, buffer + len, id);
+    }
+
+private:
+    size_t count = 0;
+    vector<uint32_t> firsts;
+    vector<uint8_t> widths;
+    vector<size_t> offsets;
+    vector<uint32_t> words;
+
+    // Lane l owns values l, l+8, l+16, ...; its bit stream is column l of the word rows
+    void pack(const uint32_t* deltas, uint32_t width) {
+        size_t base = words.size();
+        // Each lane holds ROWS * width bits, i.e. ceil(width / 2) words
+        words.resize(base + (ROWS * width + 31) / 32 * LANES, 0);
+        if (width == 0) return;
+        uint32_t* out = words.data() + base;
+        for (size_t row = 0; row < ROWS; ++row) {
+            size_t bit = row * width, w = bit >> 5, shift = bit & 31;
+            for (size_t lane = 0; lane < LANES; ++lane) {
+                uint32_t value = deltas[row * LANES + lane];
+                out[w * LANES + lane] |= value << shift;
+                if (shift + width > 32) out[(w + 1) * LANES + lane] |= value >> (32 - shift);
+            }
+        }
+    }
+
+    static void unpackScalar(const uint32_t* in, uint32_t width, uint32_t first, uint32_t* out) {
+        uint32_t mask = width == 32 ? ~0u : (1u << width) - 1;
+        uint32_t running[LANES];
+        fill(running, running + LANES, first);
+        for (size_t row = 0; row < ROWS; ++row) {
+            size_t bit = row * width, w = bit >> 5, shift = bit & 31;
+            for (size_t lane = 0; lane < LANES; ++lane) {
+                uint32_t value = width ? in[w * LANES + lane] >> shift : 0;
+                if (shift + width > 32) value |= in[(w + 1) * LANES + lane] << (32 - shift);
+                running[lane] += value & mask;
+                out[row * LANES + lane] = running[lane];
+            }
+        }
+    }
+
+#if ARRAY_SIMD_X86
+    __attribute__((target("avx2")))
+    static void unpackAVX2(const uint32_t* in, uint32_t width, uint32_t first, uint32_t* out) {
+        const __m256i* rows = reinterpret_cast<const __m256i*>(in);
+        __m256i mask = _mm256_set1_epi32(width == 32 ? -1 : static_cast<int>((1u << width) - 1));
+        __m256i running = _mm256_set1_epi32(static_cast<int>(first));
+        for (size_t row = 0; row < ROWS; ++row) {
+            size_t bit = row * width, w = bit >> 5, shift = bit & 31;
+            __m256i value = _mm256_setzero_si256();
+            if (width) {
+                value = _mm256_srl_epi32(_mm256_loadu_si256(rows + w), _mm_cvtsi32_si128(static_cast<int>(shift)));
+                if (shift + width > 32) {
+                    __m256i high = _mm256_loadu_si256(rows + w + 1);
+                    value = _mm256_or_si256(value, _mm256_sll_epi32(high, _mm_cvtsi32_si128(static_cast<int>(32 - shift))));
+                }
+            }
+            running = _mm256_add_epi32(running, _mm256_and_si256(value, mask));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + row * LANES), running);
+        }
+    }
+#endif
+};
+
+class RoaringBitmap {
+public:
+    static constexpr size_t ARRAY_LIMIT = 4096;
+    static constexpr size_t BITMAP_WORDS = 65536 / 64;
+
+    RoaringBitmap() = default;
+
+    static RoaringBitmap fromSorted(const vector<uint32_t>& ids) {
+        RoaringBitmap result;
+        size_t i = 0;
+        while (i < ids.size()) {
+            uint16_t key = static_cast<uint16_t>(ids[i] >> 16);
+            Container c;
+            for (; i < ids.size() && (ids[i] >> 16) == key; ++i) {
+                uint16_t low = static_cast<uint16_t>(ids[i]);
+                if (c.array.empty() || c.array.back() != low) c.array.push_back(low);
+            }
+            c.cardinality = c.array.size();
+            c.normalize();
+            result.keys.push_back(key);
+            result.containers.push_back(move(c));
+        }
+        return result;
+    }
+
+    void add(uint32_t id) {
+        uint16_t key = static_cast<uint16_t>(id >> 16), low = static_cast<uint16_t>(id);
+        auto it = lower_bound(keys.begin(), keys.end(), key);
+        size_t pos = static_cast<size_t>(it - keys.begin());
+        if (it == keys.end() || *it != key) {
+            keys.insert(it, key);
+            containers.insert(containers.begin() + pos, Container());
+        }
+        Container& c = containers[pos];
+        if (c.isBitmap) {
+            uint64_t& word = c.bits[low >> 6];
+            uint64_t bit = 1ULL << (low & 63);
+            c.cardinality += !(word & bit);
+            word |= bit;
+            return;
+        }
+        auto at = lower_bound(c.array.begin(), c.array.end(), low);
+        if (at != c.array.end() && *at == low) return;
+        c.array.insert(at, low);
+        ++c.cardinality;
+        c.normalize();
+    }
+
+    bool contains(uint32_t id) const {
+        uint16_t key = static_cast<uint16_t>(id >> 16), low = static_cast<uint16_t>(id);
+        auto it = lower_bound(keys.begin(), keys.end(), key);
+        if (it == keys.end() || *it != key) return false;
+        return containers[static_cast<size_t>(it - keys.begin())].contains(low);
+    }
+
+    size_t cardinality() const {
+        size_t total = 0;
+        for (const auto& c : containers) total += c.cardinality;
+        return total;
+    }
+
+    size_t bytes() const {
+        size_t total = keys.size() * (sizeof(uint16_t) + sizeof(Container));
+        for (const auto& c : containers) total += c.array.size() * sizeof(uint16_t) + c.bits.size() * sizeof(uint64_t);
+        return total;
+    }
+
+    size_t bitmapContainers() const {
+        return static_cast<size_t>(count_if(containers.begin(), containers.end(), [](const Container& c) { return c.isBitmap; }));
+    }
+
+    template <typename Fn>
+    void forEach(Fn&& fn) const {
+        for (size_t k = 0; k < keys.size(); ++k) {
+            uint32_t high = static_cast<uint32_t>(keys[k]) << 16;
+            const Container& c = containers[k];
+            if (!c.isBitmap) {
+                for (uint16_t low : c.array) fn(high | low);
+                continue;
+            }
+            for (size_t w = 0; w < BITMAP_WORDS; ++w) {
+                for (uint64_t word = c.bits[w]; word; word &= word - 1) {
+                    fn(high | static_cast<uint32_t>(w * 64 + __builtin_ctzll(word)));
+                }
+            }
+        }
+    }
+
+    vector<uint32_t> toVector() const {
+        vector<uint32_t> out;
+        out.reserve(cardinality());
+        forEach([&](uint32_t id) { out.push_back(id); });
+        return out;
+    }
+
+    static RoaringBitmap intersect(const RoaringBitmap& a, const RoaringBitmap& b) {
+        RoaringBitmap result;
+        size_t i = 0, j = 0;
+        while (i < a.keys.size() && j < b.keys.size()) {
+            if (a.keys[i] < b.keys[j]) { ++i; continue; }
+            if (b.keys[j] < a.keys[i]) { ++j; continue; }
+            Container c = Container::intersect(a.containers[i], b.containers[j]);
+            if (c.cardinality) {
+                result.keys.push_back(a.keys[i]);
+                result.containers.push_back(move(c));
+            }
+            ++i, ++j;
+        }
+        return result;
+    }
+
+    static RoaringBitmap unite(const RoaringBitmap& a, const RoaringBitmap& b) {
+        RoaringBitmap result;
+        size_t i = 0, j = 0;
+        while (i < a.keys.size() || j < b.keys.size()) {
+            if (j == b.keys.size() || (i < a.keys.size() && a.keys[i] < b.keys[j])) {
+                result.keys.push_back(a.keys[i]);
+                result.containers.push_back(a.containers[i++]);
+            } else if (i == a.keys.size() || b.keys[j] < a.keys[i]) {
+                result.keys.push_back(b.keys[j]);
+                result.containers.push_back(b.containers[j++]);
+            } else {
+                result.keys.push_back(a.keys[i]);
+                result.containers.push_back(Container::unite(a.containers[i++], b.containers[j++]));
+            }
+        }
+        return result;
+    }
+
+private:
+    struct Container {
+        bool isBitmap = false;
+        size_t cardinality = 0;
+        vector<uint16_t> array;
+        vector<uint64_t> bits;
+
+        bool contains(uint16_t low) const {
+            if (isBitmap) return (bits[low >> 6] >> (low & 63)) & 1;
+            return binary_search(array.begin(), array.end(), low);
+        }
+
+        // Switch representation when the cardinality crosses the array limit
+        void normalize() {
+            if (!isBitmap && cardinality > ARRAY_LIMIT) {
+                bits.assign(BITMAP_WORDS, 0);
+                for (uint16_t low : array) bits[low >> 6] |= 1ULL << (low & 63);
+                array = vector<uint16_t>();
+                isBitmap = true;
+            } else if (isBitmap && cardinality <= ARRAY_LIMIT) {
+                array.clear();
+                array.reserve(cardinality);
+                for (size_t w = 0; w < BITMAP_WORDS; ++w) {
+                    for (uint64_t word = bits[w]; word; word &= word - 1) {
+                        array.push_back(static_cast<uint16_t>(w * 64 + __builtin_ctzll(word)));
+                    }
+                }
+                bits = vector<uint64_t>();
+                isBitmap = false;
+            }
+        }
+
+        static Container intersect(const Container& a, const Container& b) {
+            Container out;
+            if (a.isBitmap && b.isBitmap) {
+                out.isBitmap = true;
+                out.bits.resize(BITMAP_WORDS);
+                for (size_t w = 0; w < BITMAP_WORDS; ++w) {
+                    out.bits[w] = a.bits[w] & b.bits[w];
+                    out.cardinality += __builtin_popcountll(out.bits[w]);
+                }
+                out.normalize();
+                return out;
+            }
+            if (a.isBitmap || b.isBitmap) {
+                const Container& arr = a.isBitmap ? b : a;
+                const Container& bmp = a.isBitmap ? a : b;
+                out.array.resize(arr.array.size());
+                size_t k = 0;
+                for (uint16_t low : arr.array) {
+                    out.array[k] = low;
+                    k += (bmp.bits[low >> 6] >> (low & 63)) & 1;
+                }
+                out.array.resize(k);
+                out.cardinality = k;
+                return out;
+            }
+            out.array.resize(min(a.array.size(), b.array.size()));
+            size_t i = 0, j = 0, k = 0;
+            while (i < a.array.size() && j < b.array.size()) {
+                uint16_t x = a.array[i], y = b.array[j];
+                out.array[k] = x;
+                k += (x == y);
+                i += (x <= y);
+                j += (y <= x);
+            }
+            out.array.resize(k);
+            out.cardinality = k;
+            return out;
+        }
+
+        static Container unite(const Container& a, const Container& b) {
+            if (a.isBitmap || b.isBitmap) {
+                Container out = a.isBitmap ? a : b;
+                const Container& other = a.isBitmap ? b : a;
+                if (other.isBitmap) {
+                    for (size_t w = 0; w < BITMAP_WORDS; ++w) out.bits[w] |= other.bits[w];
+                } else {
+                    for (uint16_t low : other.array) out.bits[low >> 6] |= 1ULL << (low & 63);
+                }
+                out.cardinality = 0;
+                for (uint64_t word : out.bits) out.cardinality += __builtin_popcountll(word);
+                return out;
+            }
+            Container out;
+            out.array.resize(a.array.size() + b.array.size());
+            size_t i = 0, j = 0, k = 0;
+            while (i < a.array.size() && j < b.array.size()) {
+                uint16_t x = a.array[i], y = b.array[j];
+                out.array[k++] = x < y ? x : y;
+                i += (x <= y);
+                j += (y <= x);
+            }
+            while (i < a.array.size()) out.array[k++] = a.array[i++];
+            while (j < b.array.size()) out.array[k++] = b.array[j++];
+            out.array.resize(k);
+            out.cardinality = k;
+            out.normalize();
+            return out;
+        }
+    };
+
+    vector<uint16_t> keys;
+    vector<Container> containers;
+};
+
+void demonstrateCompressedArrays() {
+    cout << "9. COMPRESSED INTEGER ARRAYS" << endl;
+    cout << "============================" << endl;
+
+    mt19937 gen(11);
+    auto makeList = [&](size_t count, uint32_t universe) {
+        vector<uint32_t> ids(count);
+        for (auto& id : ids) id = gen() % universe;
+        sort(ids.begin(), ids.end());
+        ids.erase(unique(ids.begin(), ids.end()), ids.end());
+        return ids;
+    };
+    auto ms = [](auto&& fn) {
+        auto start = high_resolution_clock::now();
+        fn();
+        return duration<double, milli>(high_resolution_clock::now() - start).count();
+    };
+
+    vector<uint32_t> dense = makeList(1 << 22, 1u << 24);
+    vector<uint32_t> sparse = makeList(1 << 18, 1u << 30);
+
+    cout << fixed << setprecision(2);
+    for (const auto* ids : {&dense, &sparse}) {
+        PackedIdArray packed(*ids);
+        RoaringBitmap roaring = RoaringBitmap::fromSorted(*ids);
+        double raw = ids->size() * sizeof(uint32_t);
+        cout << (ids == &dense ? "Dense" : "Sparse") << " list, " << ids->size() << " IDs:" << endl;
+        cout << "  vector<uint32_t>: " << raw / (1 << 20) << " MB" << endl;
+        cout << "  PackedIdArray:    " << packed.bytes() / double(1 << 20) << " MB ("
+             << raw / packed.bytes() << "x)" << endl;
+        cout << "  RoaringBitmap:    " << roaring.bytes() / double(1 << 20) << " MB ("
+             << raw / roaring.bytes() << "x, " << roaring.bitmapContainers() << " bitmap containers)" << endl;
+
+        uint64_t rawSum = 0, packedSum = 0;
+        double rawMs = ms([&] { for (uint32_t id : *ids) rawSum += id; });
+        double packedMs = ms([&] { packed.forEach([&](uint32_t id) { packedSum += id; }); });
+        bool ok = packed.decode() == *ids && roaring.toVector() == *ids && rawSum == packedSum;
+        cout << "  Scan: raw " << rawMs << " ms, packed " << packedMs << " ms"
+             << (ok ? "" : "  MISMATCH") << endl;
+    }
+
+    vector<uint32_t> other = makeList(1 << 20, 1u << 24);
+    RoaringBitmap ra = RoaringBitmap::fromSorted(dense), rb = RoaringBitmap::fromSorted(other);
+    vector<uint32_t> expected = SortedSetKernels::intersect(dense, other);
+    vector<uint32_t> viaRoaring;
+    cout << "\nIntersect " << dense.size() << " with " << other.size() << " IDs:" << endl;
+    cout << "  SortedSetKernels: " << ms([&] { SortedSetKernels::intersect(dense, other); }) << " ms" << endl;
+    cout << "  RoaringBitmap:    " << ms([&] { viaRoaring = RoaringBitmap::intersect(ra, rb).toVector(); }) << " ms"
+         << (viaRoaring == expected ? "" : "  MISMATCH") << endl;
+    bool unionOk = RoaringBitmap::unite(ra, rb).toVector() == SortedSetKernels::unite(dense, other);
+    cout << "  Union matches merge kernel: " << (unionOk ? "yes" : "no") << endl;
+    cout << defaultfloat << setprecision(6);
+
+    cout << endl;
+}
+
 /*
  * ========================================================================
  * MAIN FUNCTION
@@ -919,6 +2463,10 @@ int main() {
     demonstrateTwoPointerTechniques();
     demonstrateSlidingWindow();
     demonstratePrefixSum();
+    demonstrateVectorizedOperations();
+    demonstrateParallelScans();
+    demonstrateSortedSetKernels();
+    demonstrateCompressedArrays();
     
     cout << "=== Array Fundamentals Mastery Complete! ===" << endl;
     
@@ -21,6 +21,27 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <climits>
+#include <map>
+#include <thread>
+#include <atomic>
+#include <tuple>
+#include <numeric>
+#include <cstring>
+#include <chrono>
+#include <string>
+#include <type_traits>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <set>
+#include <functional>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define KSUM_SIMD_X86 1
+#else
+#define KSUM_SIMD_X86 0
+#endif
 
 using namespace std;
 
@@ -586,6 +607,1582 @@ public:
     }
 };
 
+// ========================================================================
+// PROBLEM 16: MAXIMUM SUBARRAY AT SCALE (PARALLEL SEGMENT COMBINATION) ⭐⭐⭐
+// ========================================================================
+/*
+ * Same question as Problem 5, but for billions of values (e.g. P&L deltas).
+ * Kadane's loop is serial, so instead summarize each chunk by four numbers:
+ *
+ *   total      - sum of the whole chunk
+ *   bestPrefix - best sum of a non-empty prefix
+ *   bestSuffix - best sum of a non-empty suffix
+ *   best       - best sum of any non-empty subarray inside the chunk
+ *
+ * Two adjacent summaries L, R combine in O(1):
+ *   total      = L.total + R.total
+ *   bestPrefix = max(L.bestPrefix, L.total + R.bestPrefix)
+ *   bestSuffix = max(R.bestSuffix, L.bestSuffix + R.total)
+ *   best       = max(L.best, R.best, L.bestSuffix + R.bestPrefix)
+ *
+ * The combine is associative, so chunks can be summarized on separate
+ * threads, kept in a segment tree for O(log n) chunk updates, or folded
+ * as chunks stream in. Sums are 64-bit to survive long inputs.
+ */
+
+struct SegmentSummary {
+    long long total = 0;
+    long long bestPrefix = LLONG_MIN, bestSuffix = LLONG_MIN, best = LLONG_MIN;
+    size_t prefixEnd = 0, suffixStart = 0;   // Global inclusive indices
+    size_t bestStart = 0, bestEnd = 0;
+    bool empty = true;
+
+    static SegmentSummary combine(const SegmentSummary& L, const SegmentSummary& R) {
+        if (L.empty) return R;
+        if (R.empty) return L;
+        SegmentSummary s;
+        s.empty = false;
+        s.total = L.total + R.total;
+
+        s.bestPrefix = L.bestPrefix;
+        s.prefixEnd = L.prefixEnd;
+        if (L.total + R.bestPrefix > s.bestPrefix) {
+            s.bestPrefix = L.total + R.bestPrefix;
+            s.prefixEnd = R.prefixEnd;
+        }
+
+        s.bestSuffix = R.bestSuffix;
+        s.suffixStart = R.suffixStart;
+        if (L.bestSuffix + R.total > s.bestSuffix) {
+            s.bestSuffix = L.bestSuffix + R.total;
+            s.suffixStart = L.suffixStart;
+        }
+
+        // Prefer the leftmost answer on ties, like maxSubArrayWithArray
+        s.best = L.best;
+        s.bestStart = L.bestStart;
+        s.bestEnd = L.bestEnd;
+        if (L.bestSuffix + R.bestPrefix > s.best) {
+            s.best = L.bestSuffix + R.bestPrefix;
+            s.bestStart = L.suffixStart;
+            s.bestEnd = R.prefixEnd;
+        }
+        if (R.best > s.best) {
+            s.best = R.best;
+            s.bestStart = R.bestStart;
+            s.bestEnd = R.bestEnd;
+        }
+        return s;
+    }
+
+    // One serial pass; `offset` is the global index of data[0]
+    static SegmentSummary summarize(const int* data, size_t n, size_t offset = 0) {
+        SegmentSummary s;
+        if (n == 0) return s;
+        s.empty = false;
+
+        long long running = 0;
+        long long minPrefix = 0;    // Smallest P[i] for i < current, P[0] = 0
+        size_t minPrefixIdx = 0;
+        long long endingHere = 0;
+        size_t endingStart = 0;
+
+        for (size_t i = 0; i < n; ++i) {
+            // Suffix candidate [i, n) is total - P[i]; track the min P[i] seen so far
+            if (i > 0 && running < minPrefix) {
+                minPrefix = running;
+                minPrefixIdx = i;
+            }
+            running += data[i];
+            if (running > s.bestPrefix) {
+                s.bestPrefix = running;
+                s.prefixEnd = offset + i;
+            }
+            if (i == 0 || endingHere < 0) {
+                endingHere = data[i];
+                endingStart = i;
+            } else {
+                endingHere += data[i];
+            }
+            if (endingHere > s.best) {
+                s.best = endingHere;
+                s.bestStart = offset + endingStart;
+                s.bestEnd = offset + i;
+            }
+        }
+        s.total = running;
+        s.bestSuffix = running - minPrefix;
+        s.suffixStart = offset + minPrefixIdx;
+        return s;
+    }
+};
+
+class ParallelMaxSubarray {
+public:
+    // Summarize `threads` chunks concurrently, then fold left to right
+    static SegmentSummary summarizeParallel(const vector<int>& nums, unsigned threads = 0) {
+        size_t n = nums.size();
+        if (threads == 0) threads = max(1u, thread::hardware_concurrency());
+        threads = static_cast<unsigned>(max<size_t>(1, min<size_t>(threads, n)));
+
+        vector<SegmentSummary> parts(threads);
+        vector<thread> workers;
+        for (unsigned t = 0; t < threads; ++t) {
+            size_t begin = n * t / threads, end = n * (t + 1) / threads;
+            workers.emplace_back([&, t, begin, end] {
+                parts[t] = SegmentSummary::summarize(nums.data() + begin, end - begin, begin);
+            });
+        }
+        for (auto& w : workers) w.join();
+
+        SegmentSummary result;
+        for (auto& part : parts) result = SegmentSummary::combine(result, part);
+        return result;
+    }
+
+    static long long maxSubArray(const vector<int>& nums, unsigned threads = 0) {
+        return summarizeParallel(nums, threads).best;
+    }
+
+    // Returns {sum, start, end} with inclusive indices
+    static tuple<long long, size_t, size_t> maxSubArrayWithRange(const vector<int>& nums,
+                                                                 unsigned threads = 0) {
+        SegmentSummary s = summarizeParallel(nums, threads);
+        return {s.best, s.bestStart, s.bestEnd};
+    }
+};
+
+/*
+ * Streaming / updatable variant: values arrive in fixed-size chunks.
+ * Chunk summaries live at the leaves of a segment tree, so appending or
+ * rewriting a chunk costs O(chunkSize + log chunks) and the global answer
+ * is always at the root. Chunk c starts at global index c * chunkSize, so
+ * only the last chunk may be shorter than chunkSize.
+ */
+class ChunkedMaxSubarray {
+private:
+    size_t chunkSize;
+    size_t chunkCount = 0;
+    size_t lastLength = 0;              // Values in the last chunk
+    size_t capacity = 1;                // Leaves in the tree (power of two)
+    vector<SegmentSummary> tree;        // 1-based heap layout
+
+    void rebuild(size_t newCapacity) {
+        vector<SegmentSummary> leaves(tree.begin() + capacity, tree.begin() + capacity + chunkCount);
+        capacity = newCapacity;
+        tree.assign(2 * capacity, SegmentSummary());
+        for (size_t i = 0; i < leaves.size(); ++i) tree[capacity + i] = leaves[i];
+        for (size_t i = capacity - 1; i >= 1; --i) {
+            tree[i] = SegmentSummary::combine(tree[2 * i], tree[2 * i + 1]);
+        }
+    }
+
+    void setLeaf(size_t chunk, const SegmentSummary& s) {
+        size_t pos = capacity + chunk;
+        tree[pos] = s;
+        for (pos /= 2; pos >= 1; pos /= 2) {
+            tree[pos] = SegmentSummary::combine(tree[2 * pos], tree[2 * pos + 1]);
+        }
+    }
+
+public:
+    explicit ChunkedMaxSubarray(size_t chunkSize) : chunkSize(chunkSize), tree(2) {
+        if (chunkSize == 0) throw invalid_argument("Chunk size must be positive");
+    }
+
+    // Append the next chunk (at most chunkSize values); returns its index.
+    // Throws once a short chunk has been appended: it must stay last.
+    size_t appendChunk(const vector<int>& values) {
+        if (values.size() > chunkSize) throw invalid_argument("Chunk longer than chunkSize");
+        if (chunkCount > 0 && lastLength < chunkSize) throw invalid_argument("Only the last chunk may be short");
+        if (chunkCount == capacity) rebuild(capacity * 2);
+        size_t chunk = chunkCount++;
+        lastLength = values.size();
+        setLeaf(chunk, SegmentSummary::summarize(values.data(), values.size(), chunk * chunkSize));
+        return chunk;
+    }
+
+    // Replace an existing chunk, e.g. when late corrections arrive. Every
+    // chunk but the last must keep exactly chunkSize values.
+    void updateChunk(size_t chunk, const vector<int>& values) {
+        if (chunk >= chunkCount) throw out_of_range("No such chunk");
+        if (values.size() > chunkSize) throw invalid_argument("Chunk longer than chunkSize");
+        bool last = chunk + 1 == chunkCount;
+        if (!last && values.size() != chunkSize) throw invalid_argument("Only the last chunk may be short");
+        if (last) lastLength = values.size();
+        setLeaf(chunk, SegmentSummary::summarize(values.data(), values.size(), chunk * chunkSize));
+    }
+
+    const SegmentSummary& summary() const { return tree[1]; }
+};
+
+/*
+ * 2D mode: maximum-sum submatrix. Fix a top row, then extend the bottom
+ * row one at a time while accumulating column sums; Kadane over those
+ * column sums gives the best rectangle with that top/bottom pair.
+ * O(R² * C) time; top rows are handed out to threads through an atomic
+ * counter, so uneven work (early rows do more) balances itself.
+ */
+struct SubmatrixResult {
+    long long sum = LLONG_MIN;
+    int top = 0, left = 0, bottom = 0, right = 0;
+};
+
+class MaxSumSubmatrix {
+public:
+    static SubmatrixResult maxSumSubmatrix(const vector<vector<int>>& matrix, unsigned threads = 0) {
+        SubmatrixResult best;
+        int rows = static_cast<int>(matrix.size());
+        if (rows == 0 || matrix[0].empty()) return best;
+        int cols = static_cast<int>(matrix[0].size());
+
+        // Kadane runs along the longer side so the R² factor uses the shorter one
+        bool transposed = rows > cols;
+        vector<long long> grid(static_cast<size_t>(rows) * cols);
+        if (transposed) swap(rows, cols);
+        for (int r = 0; r < rows; ++r) {
+            for (int c = 0; c < cols; ++c) {
+                grid[static_cast<size_t>(r) * cols + c] = transposed ? matrix[c][r] : matrix[r][c];
+            }
+        }
+
+        if (threads == 0) threads = max(1u, thread::hardware_concurrency());
+        threads = min<unsigned>(threads, static_cast<unsigned>(rows));
+        atomic<int> nextTop{0};
+        vector<SubmatrixResult> partial(threads);
+        vector<thread> workers;
+
+        for (unsigned t = 0; t < threads; ++t) {
+            workers.emplace_back([&, t] {
+                vector<long long> columnSums(cols);
+                SubmatrixResult& local = partial[t];
+                for (int top = nextTop++; top < rows; top = nextTop++) {
+                    fill(columnSums.begin(), columnSums.end(), 0);
+                    for (int bottom = top; bottom < rows; ++bottom) {
+                        const long long* row = grid.data() + static_cast<size_t>(bottom) * cols;
+                        long long endingHere = 0;
+                        int start = 0;
+                        for (int c = 0; c < cols; ++c) {
+                            columnSums[c] += row[c];
+                            if (c == 0 || endingHere < 0) {
+                                endingHere = columnSums[c];
+                                start = c;
+                            } else {
+                                endingHere += columnSums[c];
+                            }
+                            if (endingHere > local.sum) {
+                                local = {endingHere, top, start, bottom, c};
+                            }
+                        }
+                    }
+                }
+            });
+        }
+        for (auto& w : workers) w.join();
+
+        for (auto& p : partial) {
+            if (p.sum > best.sum) best = p;
+        }
+        if (transposed) {
+            swap(best.top, best.left);
+            swap(best.bottom, best.right);
+        }
+        return best;
+    }
+};
+
+// Seeded randomized check of ChunkedMaxSubarray (random appends, updates
+// and a short last chunk) against Kadane, and of MaxSumSubmatrix against
+// an O(R^2 C^2) brute force; also checks the rejected chunk shapes
+bool checkMaxSubarrayEngines(unsigned seed, int cases) {
+    mt19937 gen(seed);
+    auto pick = [&](int lo, int hi) { return uniform_int_distribution<int>(lo, hi)(gen); };
+    auto randomValues = [&](size_t n) {
+        vector<int> v(n);
+        for (int& x : v) x = pick(-20, 20);
+        return v;
+    };
+    
+    for (int c = 0; c < cases; ++c) {
+        size_t chunkSize = pick(1, 6);
+        size_t chunks = pick(1, 12);
+        ChunkedMaxSubarray stream(chunkSize);
+        vector<int> all;
+        for (size_t k = 0; k < chunks; ++k) {
+            vector<int> chunk = randomValues(k + 1 == chunks ? pick(1, static_cast<int>(chunkSize)) : chunkSize);
+            stream.appendChunk(chunk);
+            all.insert(all.end(), chunk.begin(), chunk.end());
+        }
+        for (int u = 0; u < 3; ++u) {
+            size_t k = pick(0, static_cast<int>(chunks) - 1);
+            size_t length = k + 1 == chunks ? all.size() - k * chunkSize : chunkSize;
+            vector<int> chunk = randomValues(length);
+            stream.updateChunk(k, chunk);
+            copy(chunk.begin(), chunk.end(), all.begin() + k * chunkSize);
+        }
+        const SegmentSummary& s = stream.summary();
+        long long rangeSum = 0;
+        for (size_t i = s.bestStart; i <= s.bestEnd && i < all.size(); ++i) rangeSum += all[i];
+        if (s.best != MaximumSubarray::maxSubArray(all) || rangeSum != s.best || s.bestEnd >= all.size()) return false;
+        
+        int rows = pick(1, 7), cols = pick(1, 7);
+        vector<vector<int>> matrix(rows);
+        for (auto& row : matrix) row = randomValues(cols);
+        long long expected = LLONG_MIN;
+        for (int top = 0; top < rows; ++top) {
+            for (int left = 0; left < cols; ++left) {
+                for (int bottom = top; bottom < rows; ++bottom) {
+                    for (int right = left; right < cols; ++right) {
+                        long long sum = 0;
+                        for (int r = top; r <= bottom; ++r) {
+                            for (int q = left; q <= right; ++q) sum += matrix[r][q];
+                        }
+                        expected = max(expected, sum);
+                    }
+                }
+            }
+        }
+        SubmatrixResult got = MaxSumSubmatrix::maxSumSubmatrix(matrix, pick(1, 3));
+        long long gotSum = 0;
+        for (int r = got.top; r <= got.bottom; ++r) {
+            for (int q = got.left; q <= got.right; ++q) gotSum += matrix[r][q];
+        }
+        if (got.sum != expected || gotSum != expected) return false;
+    }
+    
+    int rejected = 0;
+    ChunkedMaxSubarray stream(4);
+    stream.appendChunk({1, 2, 3, 4});
+    stream.appendChunk({5, 6});
+    auto expectThrow = [&](auto&& call) {
+        try { call(); } catch (const logic_error&) { rejected++; }
+    };
+    expectThrow([&] { stream.updateChunk(2, {1}); });
+    expectThrow([&] { stream.updateChunk(5, {1}); });
+    expectThrow([&] { stream.updateChunk(0, {1, 2}); });
+    expectThrow([&] { stream.updateChunk(1, {1, 2, 3, 4, 5}); });
+    expectThrow([&] { stream.appendChunk({7, 8, 9, 10}); });
+    expectThrow([&] { ChunkedMaxSubarray(0); });
+    return rejected == 6;
+}
+
+// ========================================================================
+// PROBLEM 17: INTERVAL ENGINE (PACKED MERGE + INCREMENTAL MERGED SET) ⭐⭐⭐
+// ========================================================================
+/*
+ * Problems 14 and 15 store each interval as a vector<int> (one heap
+ * allocation per interval) and re-sort on every call. For large calendars:
+ *
+ * 1. Packed storage: struct Interval { int lo, hi; } - 8 bytes, contiguous.
+ * 2. Batch merge without a comparison sort: already-sorted input (the
+ *    common case) is detected in O(n); otherwise an LSD radix sort on lo
+ *    runs in 4 linear passes, then one in-place sweep merges.
+ * 3. Incremental inserts: MergedIntervalSet keeps disjoint, merged
+ *    intervals in an ordered map (lo -> hi). Because the stored intervals
+ *    never overlap, ordering by lo is also ordering by hi, so no max-end
+ *    augmentation is needed: a new interval only touches its neighbours.
+ *    insert is O(log n + k) for k absorbed intervals, O(log n) amortized.
+ * 4. Queries: stab(x), overlaps(lo, hi), and listing overlapping intervals.
+ *
+ * Intervals are closed [lo, hi], matching Problems 14 and 15 (touching
+ * intervals such as [1,4] and [4,5] merge).
+ */
+
+struct Interval {
+    int lo, hi;
+
+    bool operator==(const Interval& other) const {
+        return lo == other.lo && hi == other.hi;
+    }
+};
+
+class IntervalEngine {
+public:
+    // LSD radix sort by lo (4 byte-wide passes); stable and allocation-light
+    static void radixSortByLo(vector<Interval>& intervals) {
+        vector<Interval> buffer(intervals.size());
+        for (int shift = 0; shift < 32; shift += 8) {
+            size_t count[257] = {0};
+            for (const Interval& iv : intervals) {
+                count[(radixKey(iv.lo) >> shift & 0xFF) + 1]++;
+            }
+            for (int b = 0; b < 256; ++b) count[b + 1] += count[b];
+            for (const Interval& iv : intervals) {
+                buffer[count[radixKey(iv.lo) >> shift & 0xFF]++] = iv;
+            }
+            intervals.swap(buffer);
+        }
+    }
+
+    // Merge in place; returns the same vector shrunk to the merged result
+    static void merge(vector<Interval>& intervals) {
+        if (intervals.empty()) return;
+        bool sorted = true;
+        for (size_t i = 1; i < intervals.size() && sorted; ++i) {
+            sorted = intervals[i - 1].lo <= intervals[i].lo;
+        }
+        if (!sorted) radixSortByLo(intervals);
+
+        size_t out = 0;
+        for (size_t i = 1; i < intervals.size(); ++i) {
+            if (intervals[out].hi < intervals[i].lo) {
+                intervals[++out] = intervals[i];
+            } else {
+                intervals[out].hi = max(intervals[out].hi, intervals[i].hi);
+            }
+        }
+        intervals.resize(out + 1);
+    }
+
+    // Insert into a sorted, disjoint packed array (Problem 15 semantics).
+    // Binary search finds the affected range, then one erase/insert shifts.
+    static void insert(vector<Interval>& intervals, Interval added) {
+        // First interval that ends at or after added.lo may overlap
+        auto first = lower_bound(intervals.begin(), intervals.end(), added.lo,
+                                 [](const Interval& iv, int lo) { return iv.hi < lo; });
+        // First interval that starts after added.hi cannot overlap
+        auto last = upper_bound(first, intervals.end(), added.hi,
+                                [](int hi, const Interval& iv) { return hi < iv.lo; });
+        if (first != last) {
+            added.lo = min(added.lo, first->lo);
+            added.hi = max(added.hi, (last - 1)->hi);
+            *first = added;
+            intervals.erase(first + 1, last);
+        } else {
+            intervals.insert(first, added);
+        }
+    }
+
+private:
+    // Flip the sign bit so negative values sort before positive ones
+    static unsigned radixKey(int value) {
+        return static_cast<unsigned>(value) ^ 0x80000000u;
+    }
+};
+
+class MergedIntervalSet {
+private:
+    map<int, int> spans;  // lo -> hi, pairwise disjoint
+
+    static void checkBounds(int lo, int hi) {
+        if (lo > hi) throw invalid_argument("Interval lo exceeds hi");
+    }
+
+public:
+    void insert(int lo, int hi) {
+        checkBounds(lo, hi);
+        // Candidate to the left: the last span starting at or before lo
+        auto it = spans.upper_bound(lo);
+        if (it != spans.begin()) {
+            auto prev = std::prev(it);
+            if (prev->second >= lo) {
+                if (prev->second >= hi) return;  // Already covered
+                lo = prev->first;
+                it = prev;
+            }
+        }
+        // Absorb every span starting inside [lo, hi]
+        while (it != spans.end() && it->first <= hi) {
+            hi = max(hi, it->second);
+            it = spans.erase(it);
+        }
+        spans.emplace_hint(it, lo, hi);
+    }
+
+    // Remove [lo, hi], splitting spans that straddle the boundaries. A piece
+    // [.., lo - 1] is kept only below some span start < lo, and [hi + 1, ..]
+    // only under some span end > hi, so at INT_MIN / INT_MAX neither exists
+    // and lo - 1 / hi + 1 are never formed.
+    void erase(int lo, int hi) {
+        checkBounds(lo, hi);
+        auto it = spans.upper_bound(lo);
+        if (it != spans.begin()) {
+            auto prev = std::prev(it);
+            if (prev->second >= lo) {
+                int oldHi = prev->second;
+                if (prev->first < lo) {  // lo > INT_MIN
+                    prev->second = lo - 1;
+                } else {
+                    spans.erase(prev);
+                }
+                if (oldHi > hi) {  // hi < INT_MAX
+                    spans.emplace(hi + 1, oldHi);
+                    return;
+                }
+            }
+        }
+        while (it != spans.end() && it->first <= hi) {
+            if (it->second > hi) {  // hi < INT_MAX
+                int oldHi = it->second;
+                spans.erase(it);
+                spans.emplace(hi + 1, oldHi);
+                return;
+            }
+            it = spans.erase(it);
+        }
+    }
+
+    // Stabbing query: the span containing x, if any
+    bool stab(int x, Interval* found = nullptr) const {
+        auto it = spans.upper_bound(x);
+        if (it == spans.begin()) return false;
+        --it;
+        if (it->second < x) return false;
+        if (found) *found = {it->first, it->second};
+        return true;
+    }
+
+    bool overlaps(int lo, int hi) const {
+        auto it = spans.upper_bound(hi);
+        return it != spans.begin() && std::prev(it)->second >= lo;
+    }
+
+    // All stored spans intersecting [lo, hi], in order
+    vector<Interval> overlapping(int lo, int hi) const {
+        vector<Interval> result;
+        auto it = spans.upper_bound(lo);
+        if (it != spans.begin() && std::prev(it)->second >= lo) --it;
+        for (; it != spans.end() && it->first <= hi; ++it) {
+            result.push_back({it->first, it->second});
+        }
+        return result;
+    }
+
+    size_t size() const { return spans.size(); }
+
+    vector<Interval> toVector() const {
+        vector<Interval> result;
+        result.reserve(spans.size());
+        for (auto& [lo, hi] : spans) result.push_back({lo, hi});
+        return result;
+    }
+};
+
+// Seeded randomized check of MergedIntervalSet inserts and erases against a
+// bitmap. Endpoints come from small windows at INT_MIN, 0 and INT_MAX. Every
+// operation covers or clears the values between two windows as a whole, so
+// each gap is a single bitmap cell, probed at its midpoint.
+bool checkMergedIntervalSet(unsigned seed, int cases) {
+    const long long WINDOW = 6;
+    vector<int> cells;     // Ascending: window values and one probe per gap
+    vector<size_t> ends;   // Cells usable as endpoints (window values only)
+    long long starts[] = {INT_MIN, -WINDOW / 2, static_cast<long long>(INT_MAX) - WINDOW + 1};
+    for (int w = 0; w < 3; ++w) {
+        if (w > 0) cells.push_back(static_cast<int>((cells.back() + starts[w]) / 2));
+        for (long long v = starts[w]; v < starts[w] + WINDOW; ++v) {
+            ends.push_back(cells.size());
+            cells.push_back(static_cast<int>(v));
+        }
+    }
+    
+    mt19937 gen(seed);
+    auto pick = [&](size_t n) { return uniform_int_distribution<size_t>(0, n - 1)(gen); };
+    for (int c = 0; c < cases; ++c) {
+        MergedIntervalSet set;
+        vector<bool> covered(cells.size(), false);
+        for (int op = 0; op < 24; ++op) {
+            size_t a = ends[pick(ends.size())], b = ends[pick(ends.size())];
+            if (a > b) swap(a, b);
+            bool adding = pick(3) != 0;
+            if (adding) {
+                set.insert(cells[a], cells[b]);
+            } else {
+                set.erase(cells[a], cells[b]);
+            }
+            fill(covered.begin() + a, covered.begin() + b + 1, adding);
+            
+            vector<Interval> spans = set.toVector();
+            for (size_t i = 0; i < spans.size(); ++i) {
+                if (spans[i].lo > spans[i].hi || (i > 0 && spans[i - 1].hi >= spans[i].lo)) return false;
+            }
+            for (size_t i = 0; i < cells.size(); ++i) {
+                Interval hit;
+                bool inside = set.stab(cells[i], &hit);
+                if (inside != covered[i] || (inside && (hit.lo > cells[i] || hit.hi < cells[i]))) return false;
+            }
+            size_t qa = ends[pick(ends.size())], qb = ends[pick(ends.size())];
+            if (qa > qb) swap(qa, qb);
+            bool any = find(covered.begin() + qa, covered.begin() + qb + 1, true) != covered.begin() + qb + 1;
+            if (set.overlaps(cells[qa], cells[qb]) != any ||
+                set.overlapping(cells[qa], cells[qb]).empty() == any) return false;
+        }
+    }
+    
+    MergedIntervalSet set;
+    int rejected = 0;
+    try { set.insert(2, 1); } catch (const invalid_argument&) { rejected++; }
+    try { set.erase(INT_MAX, INT_MIN); } catch (const invalid_argument&) { rejected++; }
+    return rejected == 2 && set.size() == 0;
+}
+
+// ========================================================================
+// PROBLEM 18: K-SUM BATCH ENGINE (FLAT BUFFERS + HASH JOIN) ⭐⭐⭐
+// ========================================================================
+/*
+ * Problems 1 and 9 build an unordered_map or a vector<vector<int>> per
+ * call. For matching millions of orders:
+ *
+ * 1. Sorted, deduplicated input: values[] holds each distinct value once
+ *    and counts[] its multiplicity, so duplicate skipping disappears and
+ *    the two-pointer scan walks fewer elements.
+ * 2. SIMD two-pointer: when the low pointer must advance past many small
+ *    values, 8 candidates are compared at once (AVX2) instead of one.
+ * 3. Parallel outer loop for 3-sum/4-sum/k-sum: threads claim first
+ *    values through an atomic counter and append tuples to their own
+ *    flat buffer (stride k); buffers are stitched together in order.
+ * 4. Radix-partitioned hash join for two-sum between two large sides:
+ *    both sides are split by key bits into partitions small enough for
+ *    cache, then each partition is joined with a tiny open-addressing
+ *    table instead of one giant unordered_map.
+ */
+
+class KSumEngine {
+private:
+    vector<int> values;   // Distinct values, ascending
+    vector<int> counts;   // Multiplicity of values[i]
+
+public:
+    explicit KSumEngine(vector<int> nums) {
+        sort(nums.begin(), nums.end());
+        for (size_t i = 0; i < nums.size(); ++i) {
+            if (values.empty() || values.back() != nums[i]) {
+                values.push_back(nums[i]);
+                counts.push_back(1);
+            } else {
+                counts.back()++;
+            }
+        }
+    }
+
+    size_t distinctCount() const { return values.size(); }
+
+    /*
+     * All distinct k-tuples (non-decreasing) summing to target, written to
+     * one flat buffer: tuple t occupies out[t*k .. t*k + k - 1].
+     * Output order matches the classic sorted two-pointer solutions.
+     */
+    vector<int> kSum(int k, long long target, unsigned threads = 0) const {
+        vector<int> out;
+        if (k < 2 || values.empty()) return out;
+        if (k == 2) {
+            vector<int> prefix;
+            twoPointer(0, 0, target, prefix, out);
+            return out;
+        }
+
+        if (threads == 0) threads = max(1u, thread::hardware_concurrency());
+        size_t n = values.size();
+
+        struct Segment { size_t first, begin, end; };
+        vector<vector<int>> buffers(threads);
+        vector<vector<Segment>> segments(threads);
+        atomic<size_t> next{0};
+
+        auto worker = [&](unsigned t) {
+            vector<int> prefix;
+            for (size_t i = next++; i < n; i = next++) {
+                size_t begin = buffers[t].size();
+                prefix.assign(1, values[i]);
+                recurse(k - 1, i, 1, target - values[i], prefix, buffers[t]);
+                if (buffers[t].size() != begin) segments[t].push_back({i, begin, buffers[t].size()});
+            }
+        };
+        vector<thread> pool;
+        for (unsigned t = 1; t < threads; ++t) pool.emplace_back(worker, t);
+        worker(0);
+        for (auto& th : pool) th.join();
+
+        // Stitch per-thread segments back into first-value order
+        vector<pair<size_t, pair<unsigned, size_t>>> order;
+        for (unsigned t = 0; t < threads; ++t) {
+            for (size_t s = 0; s < segments[t].size(); ++s) order.push_back({segments[t][s].first, {t, s}});
+        }
+        sort(order.begin(), order.end());
+        for (auto& [first, where] : order) {
+            const Segment& seg = segments[where.first][where.second];
+            out.insert(out.end(), buffers[where.first].begin() + seg.begin,
+                       buffers[where.first].begin() + seg.end);
+        }
+        return out;
+    }
+
+    /*
+     * Two-sum between two sides (e.g. bids and asks): every index pair
+     * (i, j) with left[i] + right[j] == target.
+     * Pass 1 partitions by the high bits of a multiplicative hash of the
+     * key; the right side is partitioned by its complement, so matching
+     * pairs always land in the same partition. The fanout grows with the
+     * left side so each partition's build (entries, slots and chains, about
+     * 20 bytes per left entry) stays near JOIN_PARTITION_TARGET entries,
+     * i.e. inside L2, up to 2^JOIN_MAX_BITS partitions (~134M left rows).
+     */
+    static constexpr size_t JOIN_PARTITION_TARGET = 1 << 13;
+    static constexpr int JOIN_MAX_BITS = 14;
+    
+
+    static vector<pair<uint32_t, uint32_t>> hashJoinTwoSum(const vector<int>& left,
+                                                            const vector<int>& right,
+                                                            long long target) {
+        int bits = 0;
+        while (bits < JOIN_MAX_BITS && (left.size() >> bits) > JOIN_PARTITION_TARGET) ++bits;
+        const int BITS = bits;
+        const size_t P = size_t(1) << BITS;
+
+        struct Entry { int key; uint32_t index; };
+        auto partitionOf = [&](long long key) {
+            // Shifting a 64-bit value by 64 is undefined, so one partition is special
+            return BITS == 0 ? 0 : static_cast<size_t>((static_cast<uint64_t>(key) * 0x9E3779B97F4A7C15ULL) >> (64 - BITS));
+        };
+
+        auto scatter = [&](const vector<int>& side, bool complement, vector<Entry>& out,
+                           vector<size_t>& offsets) {
+            offsets.assign(P + 1, 0);
+            vector<long long> keys(side.size());
+            for (size_t i = 0; i < side.size(); ++i) {
+                keys[i] = complement ? target - side[i] : side[i];
+                offsets[partitionOf(keys[i]) + 1]++;
+            }
+            for (size_t p = 0; p < P; ++p) offsets[p + 1] += offsets[p];
+            vector<size_t> cursor(offsets.begin(), offsets.end() - 1);
+            out.resize(side.size());
+            for (size_t i = 0; i < side.size(); ++i) {
+                // Out-of-range complements are clamped here and skipped when probing
+                int key = static_cast<int>(max<long long>(INT_MIN, min<long long>(INT_MAX, keys[i])));
+                out[cursor[partitionOf(keys[i])]++] = {key, static_cast<uint32_t>(i)};
+            }
+        };
+
+        vector<Entry> leftParts, rightParts;
+        vector<size_t> leftOff, rightOff;
+        scatter(left, false, leftParts, leftOff);
+        scatter(right, true, rightParts, rightOff);
+
+        vector<pair<uint32_t, uint32_t>> matches;
+        vector<int32_t> slots;           // Open-addressing table: entry index or -1
+        for (size_t p = 0; p < P; ++p) {
+            size_t lb = leftOff[p], le = leftOff[p + 1];
+            size_t rb = rightOff[p], re = rightOff[p + 1];
+            if (lb == le || rb == re) continue;
+
+            size_t cap = 16;
+            while (cap < 2 * (le - lb)) cap <<= 1;
+            slots.assign(cap, -1);
+            // High bits of the product: low bits would depend only on the
+            // key's low bits, so keys aligned to a power of two would collide
+            const int shift = 32 - __builtin_ctzll(cap);
+            auto slotOf = [shift](int key) {
+                return static_cast<size_t>((static_cast<uint32_t>(key) * 0x85EBCA6Bu) >> shift);
+            };
+            // Chain equal keys through `nextSame` so duplicates are all reported
+            vector<int32_t> nextSame(le - lb, -1);
+            for (size_t e = lb; e < le; ++e) {
+                size_t h = slotOf(leftParts[e].key);
+                while (slots[h] != -1 && leftParts[lb + slots[h]].key != leftParts[e].key) h = (h + 1) & (cap - 1);
+                nextSame[e - lb] = slots[h];
+                slots[h] = static_cast<int32_t>(e - lb);
+            }
+            for (size_t e = rb; e < re; ++e) {
+                long long want = target - right[rightParts[e].index];
+                if (want < INT_MIN || want > INT_MAX) continue;
+                size_t h = slotOf(rightParts[e].key);
+                while (slots[h] != -1 && leftParts[lb + slots[h]].key != rightParts[e].key) h = (h + 1) & (cap - 1);
+                for (int32_t s = slots[h]; s != -1; s = nextSame[s]) {
+                    matches.push_back({leftParts[lb + s].index, rightParts[e].index});
+                }
+            }
+        }
+        sort(matches.begin(), matches.end());
+        return matches;
+    }
+
+private:
+    // Choose k more values starting at index `start`, of which `used`
+    // copies of values[start] are already in the prefix
+    void recurse(int k, size_t start, int used, long long target, vector<int>& prefix,
+                 vector<int>& out) const {
+        if (k == 2) {
+            twoPointer(start, used, target, prefix, out);
+            return;
+        }
+        for (size_t i = start; i < values.size(); ++i) {
+            int available = counts[i] - (i == start ? used : 0);
+            if (available <= 0) continue;
+            // Smallest possible completion already too large: stop
+            if (static_cast<long long>(values[i]) * k > target) break;
+            prefix.push_back(values[i]);
+            recurse(k - 1, i, (i == start ? used : 0) + 1, target - values[i], prefix, out);
+            prefix.pop_back();
+        }
+    }
+
+    void twoPointer(size_t start, int used, long long target, const vector<int>& prefix,
+                    vector<int>& out) const {
+        if (values.empty()) return;
+        size_t lo = start, hi = values.size() - 1;
+        if (counts[lo] - used <= 0) ++lo;
+        while (lo <= hi && hi < values.size()) {
+            long long sum = static_cast<long long>(values[lo]) + values[hi];
+            if (sum < target) {
+                lo = advanceLow(lo + 1, hi, target - values[hi]);
+            } else if (sum > target) {
+                if (hi == 0) break;
+                --hi;
+            } else {
+                int available = counts[lo] - (lo == start ? used : 0);
+                if (lo < hi || available >= 2) {
+                    out.insert(out.end(), prefix.begin(), prefix.end());
+                    out.push_back(values[lo]);
+                    out.push_back(values[hi]);
+                }
+                ++lo;
+                if (hi == 0) break;
+                --hi;
+            }
+        }
+    }
+
+    // First index in [lo, hi] with values[idx] >= bound (or hi + 1)
+    size_t advanceLow(size_t lo, size_t hi, long long bound) const {
+        if (bound > INT_MAX) return hi + 1;
+        if (bound <= INT_MIN) return lo;
+#if KSUM_SIMD_X86
+        static const bool hasAVX2 = __builtin_cpu_supports("avx2");
+        if (hasAVX2) return advanceLowAVX2(values.data(), lo, hi, static_cast<int>(bound));
+#endif
+        while (lo <= hi && values[lo] < bound) ++lo;
+        return lo;
+    }
+
+#if KSUM_SIMD_X86
+    __attribute__((target("avx2")))
+    static size_t advanceLowAVX2(const int* data, size_t lo, size_t hi, int bound) {
+        // A short scalar probe first: most steps only move by one or two
+        for (int step = 0; step < 4; ++step, ++lo) {
+            if (lo > hi || data[lo] >= bound) return lo;
+        }
+        const __m256i limit = _mm256_set1_epi32(bound);
+        while (lo + 8 <= hi + 1) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + lo));
+            unsigned less = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(limit, v))));
+            if (less != 0xFF) return lo + __builtin_ctz(~less);
+            lo += 8;
+        }
+        while (lo <= hi && data[lo] < bound) ++lo;
+        return lo;
+    }
+#endif
+};
+
+// Seeded randomized check of kSum (k = 2..4) and hashJoinTwoSum against
+// nested-loop brute force; small value ranges force many duplicates
+bool checkKSumEngine(unsigned seed, int cases) {
+    mt19937 gen(seed);
+    auto pick = [&](int lo, int hi) { return uniform_int_distribution<int>(lo, hi)(gen); };
+    
+    for (int c = 0; c < cases; ++c) {
+        vector<int> nums(pick(0, 12));
+        for (int& v : nums) v = pick(-6, 6);
+        KSumEngine engine(nums);
+        for (int k = 2; k <= 4; ++k) {
+            long long target = pick(-8, 8);
+            set<vector<int>> expected;
+            vector<size_t> idx(k);
+            // Enumerate index combinations idx[0] < ... < idx[k-1]
+            function<void(int, size_t, long long)> choose = [&](int depth, size_t from, long long sum) {
+                if (depth == k) {
+                    if (sum != target) return;
+                    vector<int> tuple;
+                    for (size_t i : idx) tuple.push_back(nums[i]);
+                    sort(tuple.begin(), tuple.end());
+                    expected.insert(tuple);
+                    return;
+                }
+                for (size_t i = from; i < nums.size(); ++i) {
+                    idx[depth] = i;
+                    choose(depth + 1, i + 1, sum + nums[i]);
+                }
+            };
+            choose(0, 0, 0);
+            
+            vector<int> flat = engine.kSum(k, target, static_cast<unsigned>(pick(1, 4)));
+            vector<vector<int>> got;
+            for (size_t t = 0; t + k <= flat.size(); t += k) got.emplace_back(flat.begin() + t, flat.begin() + t + k);
+            if (flat.size() % k != 0 || got != vector<vector<int>>(expected.begin(), expected.end())) return false;
+        }
+        
+        // Join sides mix small values, power-of-two multiples and extremes
+        auto side = [&](size_t n) {
+            vector<int> out(n);
+            for (int& v : out) {
+                int kind = pick(0, 9);
+                v = kind < 6 ? pick(-8, 8) : kind < 9 ? pick(-64, 64) * 4096 : (pick(0, 1) ? INT_MAX : INT_MIN);
+            }
+            return out;
+        };
+        vector<int> left = side(pick(0, 40)), right = side(pick(0, 40));
+        long long target = pick(0, 3) == 0 ? static_cast<long long>(left.empty() ? 0 : left[0]) + INT_MAX : pick(-16, 16) * 4096LL;
+        vector<pair<uint32_t, uint32_t>> expected;
+        for (uint32_t i = 0; i < left.size(); ++i) {
+            for (uint32_t j = 0; j < right.size(); ++j) {
+                if (static_cast<long long>(left[i]) + right[j] == target) expected.push_back({i, j});
+            }
+        }
+        if (KSumEngine::hashJoinTwoSum(left, right, target) != expected) return false;
+    }
+    
+    // Left sides past JOIN_PARTITION_TARGET, so the join really partitions;
+    // checked against an index of right positions by value
+    for (int c = 0; c < 4; ++c) {
+        vector<int> left(pick(9000, 140000)), right(pick(1000, 5000));
+        for (int& v : left) v = pick(-50000, 50000);
+        for (int& v : right) v = pick(-50000, 50000);
+        long long target = pick(-1000, 1000);
+        map<int, vector<uint32_t>> positions;
+        for (uint32_t j = 0; j < right.size(); ++j) positions[right[j]].push_back(j);
+        vector<pair<uint32_t, uint32_t>> expected;
+        for (uint32_t i = 0; i < left.size(); ++i) {
+            auto it = positions.find(static_cast<int>(target - left[i]));
+            if (it == positions.end()) continue;
+            for (uint32_t j : it->second) expected.push_back({i, j});
+        }
+        if (KSumEngine::hashJoinTwoSum(left, right, target) != expected) return false;
+    }
+    return true;
+}
+
+// ========================================================================
+// PROBLEM 19: STREAMING RAIN WATER & HISTOGRAM ENGINE (CHUNKED INPUT) ⭐⭐⭐
+// ========================================================================
+/*
+ * Problem 11 (and Largest Rectangle in Histogram / Maximal Rectangle)
+ * need the whole height array in memory. For terrain too large for RAM:
+ *
+ * 1. Streaming monotonic stacks carried across chunks:
+ *    - Water: a strictly decreasing stack of (height, position). When a
+ *      taller bar arrives, each popped bar is a basin floor bounded by the
+ *      new bar and the bar below it. Equal heights collapse into one entry.
+ *    - Histogram: a strictly increasing stack of (height, start). Popping
+ *      closes every rectangle that cannot extend further right.
+ *    Only the stacks and a running position survive between chunks, so
+ *    memory is O(stack depth) rather than O(n) (with byte heights the
+ *    depth is at most 256).
+ * 2. Parallel 1D water: each tile reports its max; prefix/suffix maxima of
+ *    the tile maxima give every tile its outside walls; tiles then finish
+ *    independently.
+ * 3. Parallel 2D maximal rectangle on a packed byte raster: horizontal
+ *    bands compute per-column "ones at the bottom" runs in parallel, a
+ *    serial merge turns them into the column heights entering each band,
+ *    and bands then run the row-by-row histogram scan in parallel.
+ */
+
+class StreamingWater {
+private:
+    struct Bar { long long height; long long pos; };
+    vector<Bar> stack;
+    long long position = 0;
+    long long water = 0;
+
+public:
+    void feed(const int* heights, size_t n) {
+        for (size_t i = 0; i < n; ++i, ++position) {
+            long long h = heights[i];
+            while (!stack.empty() && h > stack.back().height) {
+                long long floor = stack.back().height;
+                stack.pop_back();
+                if (stack.empty()) break;
+                long long width = position - stack.back().pos - 1;
+                water += width * (min(h, stack.back().height) - floor);
+            }
+            if (!stack.empty() && stack.back().height == h) {
+                stack.back().pos = position;
+            } else {
+                stack.push_back({h, position});
+            }
+        }
+    }
+
+    void feed(const vector<int>& chunk) { feed(chunk.data(), chunk.size()); }
+
+    // Water that is already fully enclosed; the remaining stack can never hold more
+    long long volume() const { return water; }
+    size_t stackDepth() const { return stack.size(); }
+};
+
+class StreamingHistogram {
+private:
+    struct Run { long long height; long long start; };
+    vector<Run> stack;
+    long long position = 0;
+    long long best = 0;
+
+    void closeRunsAbove(long long h) {
+        long long start = position;
+        while (!stack.empty() && stack.back().height >= h) {
+            best = max(best, stack.back().height * (position - stack.back().start));
+            start = stack.back().start;
+            stack.pop_back();
+        }
+        if (h > 0) stack.push_back({h, start});
+    }
+
+public:
+    void feed(const int* heights, size_t n) {
+        for (size_t i = 0; i < n; ++i, ++position) closeRunsAbove(heights[i]);
+    }
+
+    void feed(const vector<int>& chunk) { feed(chunk.data(), chunk.size()); }
+
+    // Flushes open runs as if a zero-height bar followed; feeding may continue
+    long long largestRectangle() {
+        closeRunsAbove(0);
+        return best;
+    }
+};
+
+class ParallelTerrain {
+public:
+    static long long trap(const vector<int>& height, unsigned threads = 0) {
+        size_t n = height.size();
+        if (threads == 0) threads = max(1u, thread::hardware_concurrency());
+        threads = static_cast<unsigned>(max<size_t>(1, min<size_t>(threads, n)));
+        if (n == 0) return 0;
+
+        auto runTiles = [&](auto fn) {
+            vector<thread> workers;
+            for (unsigned t = 1; t < threads; ++t) workers.emplace_back(fn, t);
+            fn(0u);
+            for (auto& w : workers) w.join();
+        };
+        auto tileBegin = [&](unsigned t) { return n * t / threads; };
+
+        vector<int> tileMax(threads, INT_MIN);
+        runTiles([&](unsigned t) {
+            for (size_t i = tileBegin(t); i < tileBegin(t + 1); ++i) tileMax[t] = max(tileMax[t], height[i]);
+        });
+
+        // Walls outside each tile: best height strictly left / right of it
+        vector<int> wallLeft(threads, INT_MIN), wallRight(threads, INT_MIN);
+        for (unsigned t = 1; t < threads; ++t) wallLeft[t] = max(wallLeft[t - 1], tileMax[t - 1]);
+        for (unsigned t = threads - 1; t-- > 0;) wallRight[t] = max(wallRight[t + 1], tileMax[t + 1]);
+
+        vector<long long> tileWater(threads, 0);
+        runTiles([&](unsigned t) {
+            size_t begin = tileBegin(t), end = tileBegin(t + 1);
+            vector<int> rightMax(end - begin);
+            int running = wallRight[t];
+            for (size_t i = end; i-- > begin;) {
+                running = max(running, height[i]);
+                rightMax[i - begin] = running;
+            }
+            int leftMax = wallLeft[t];
+            long long water = 0;
+            for (size_t i = begin; i < end; ++i) {
+                leftMax = max(leftMax, height[i]);
+                water += min(leftMax, rightMax[i - begin]) - height[i];
+            }
+            tileWater[t] = water;
+        });
+        return accumulate(tileWater.begin(), tileWater.end(), 0LL);
+    }
+};
+
+// Row-major raster, one byte per cell; any non-zero byte counts as filled
+struct ByteRaster {
+    int rows = 0, cols = 0;
+    vector<uint8_t> cells;
+
+    ByteRaster(int r, int c) : rows(r), cols(c), cells(static_cast<size_t>(r) * c, 0) {}
+    uint8_t* row(int r) { return cells.data() + static_cast<size_t>(r) * cols; }
+    const uint8_t* row(int r) const { return cells.data() + static_cast<size_t>(r) * cols; }
+};
+
+class RasterRectangle {
+public:
+    static long long maximalRectangle(const ByteRaster& raster, unsigned threads = 0) {
+        int rows = raster.rows, cols = raster.cols;
+        if (rows == 0 || cols == 0) return 0;
+        if (threads == 0) threads = max(1u, thread::hardware_concurrency());
+        threads = min<unsigned>(threads, static_cast<unsigned>(rows));
+        auto bandBegin = [&](unsigned b) { return static_cast<int>(static_cast<long long>(rows) * b / threads); };
+        auto runBands = [&](auto fn) {
+            vector<thread> workers;
+            for (unsigned b = 1; b < threads; ++b) workers.emplace_back(fn, b);
+            fn(0u);
+            for (auto& w : workers) w.join();
+        };
+
+        // Pass 1: per band and column, the run of filled cells touching the band's bottom
+        vector<vector<int>> bottomRun(threads, vector<int>(cols, 0));
+        runBands([&](unsigned b) {
+            vector<int>& run = bottomRun[b];
+            for (int r = bandBegin(b); r < bandBegin(b + 1); ++r) {
+                const uint8_t* cells = raster.row(r);
+                for (int c = 0; c < cols; ++c) run[c] = cells[c] ? run[c] + 1 : 0;
+            }
+        });
+
+        // Merge: heights entering band b; a fully filled column extends the carry
+        vector<vector<int>> carryIn(threads, vector<int>(cols, 0));
+        for (unsigned b = 1; b < threads; ++b) {
+            int bandRows = bandBegin(b) - bandBegin(b - 1);
+            for (int c = 0; c < cols; ++c) {
+                int run = bottomRun[b - 1][c];
+                carryIn[b][c] = run == bandRows ? carryIn[b - 1][c] + run : run;
+            }
+        }
+
+        // Pass 2: row-by-row histogram scan inside each band
+        vector<long long> bandBest(threads, 0);
+        runBands([&](unsigned b) {
+            vector<int> heights = carryIn[b];
+            vector<int> stack;
+            stack.reserve(cols + 1);
+            long long best = 0;
+            for (int r = bandBegin(b); r < bandBegin(b + 1); ++r) {
+                const uint8_t* cells = raster.row(r);
+                for (int c = 0; c < cols; ++c) heights[c] = cells[c] ? heights[c] + 1 : 0;
+                best = max(best, largestInRow(heights, stack));
+            }
+            bandBest[b] = best;
+        });
+        return *max_element(bandBest.begin(), bandBest.end());
+    }
+
+private:
+    static long long largestInRow(const vector<int>& heights, vector<int>& stack) {
+        stack.clear();
+        long long best = 0;
+        int n = static_cast<int>(heights.size());
+        for (int i = 0; i <= n; ++i) {
+            int h = i < n ? heights[i] : 0;  // Sentinel closes every run
+            while (!stack.empty() && heights[stack.back()] >= h) {
+                long long height = heights[stack.back()];
+                stack.pop_back();
+                int left = stack.empty() ? -1 : stack.back();
+                best = max(best, height * (i - left - 1));
+            }
+            stack.push_back(i);
+        }
+        return best;
+    }
+};
+
+// Seeded randomized check of the streaming, parallel and raster engines
+// against trap() and O(n^2) / O(R^2 C^2) brute force
+bool checkTerrainEngines(unsigned seed, int cases) {
+    mt19937 gen(seed);
+    auto pick = [&](int lo, int hi) { return uniform_int_distribution<int>(lo, hi)(gen); };
+    
+    for (int c = 0; c < cases; ++c) {
+        vector<int> heights(pick(0, 60));
+        int top = pick(0, 3) == 0 ? 1000 : 9;
+        for (int& h : heights) h = pick(0, top);
+        int n = static_cast<int>(heights.size());
+        
+        long long water = 0, rectangle = 0;
+        for (int i = 0; i < n; ++i) {
+            int leftMax = *max_element(heights.begin(), heights.begin() + i + 1);
+            int rightMax = *max_element(heights.begin() + i, heights.end());
+            water += min(leftMax, rightMax) - heights[i];
+            int low = INT_MAX;
+            for (int j = i; j < n; ++j) {
+                low = min(low, heights[j]);
+                rectangle = max(rectangle, static_cast<long long>(low) * (j - i + 1));
+            }
+        }
+        
+        StreamingWater streamWater;
+        StreamingHistogram streamHistogram;
+        for (int i = 0; i < n;) {
+            int len = min(pick(1, 7), n - i);
+            streamWater.feed(heights.data() + i, len);
+            streamHistogram.feed(heights.data() + i, len);
+            i += len;
+        }
+        vector<int> copy = heights;
+        if (TrappingRainWater::trap(copy) != water || streamWater.volume() != water ||
+            ParallelTerrain::trap(heights, static_cast<unsigned>(pick(1, 5))) != water ||
+            streamHistogram.largestRectangle() != rectangle) {
+            return false;
+        }
+        
+        int rows = pick(0, 9), cols = pick(0, 9), density = pick(30, 95);
+        ByteRaster raster(rows, cols);
+        for (uint8_t& cell : raster.cells) cell = pick(0, 99) < density ? static_cast<uint8_t>(pick(1, 255)) : 0;
+        // filled[r][c] = filled cells in the top-left r x c corner
+        vector<vector<int>> filled(rows + 1, vector<int>(cols + 1, 0));
+        for (int r = 0; r < rows; ++r) {
+            for (int col = 0; col < cols; ++col) {
+                filled[r + 1][col + 1] = filled[r][col + 1] + filled[r + 1][col] - filled[r][col] + (raster.row(r)[col] != 0);
+            }
+        }
+        long long best = 0;
+        for (int r0 = 0; r0 < rows; ++r0) {
+            for (int r1 = r0 + 1; r1 <= rows; ++r1) {
+                for (int c0 = 0; c0 < cols; ++c0) {
+                    for (int c1 = c0 + 1; c1 <= cols; ++c1) {
+                        long long area = static_cast<long long>(r1 - r0) * (c1 - c0);
+                        int inside = filled[r1][c1] - filled[r0][c1] - filled[r1][c0] + filled[r0][c0];
+                        if (inside == area) best = max(best, area);
+                    }
+                }
+            }
+        }
+        if (RasterRectangle::maximalRectangle(raster, static_cast<unsigned>(pick(1, 5))) != best) return false;
+    }
+    return true;
+}
+
+// ========================================================================
+// PROBLEM 20: ROTATION ENGINE (BUFFERED / JUGGLING / BLOCK SWAP) ⭐⭐⭐
+// ========================================================================
+/*
+ * Problem 13's reversal method reads and writes every element twice and
+ * rotateExtraSpace allocates a full copy. For very large arrays the
+ * number of passes over memory is what matters, so pick per call:
+ *
+ *   Buffered  - the shorter side (<= 64 KB) is parked in a small buffer,
+ *               the rest slides over with one memmove: ~1 pass.
+ *   Juggling  - gcd(n, d) independent cycles. Walking L adjacent cycles
+ *               together moves contiguous L-element blocks, so each
+ *               step is a memcpy of whole cache lines; the next block
+ *               of the cycle is prefetched. Chosen when gcd is large.
+ *   Reversal  - three in-place reversals; sequential and cheap while the
+ *               array still fits in cache.
+ *   BlockSwap - Gries-Mills: repeatedly swap the shorter side into
+ *               place with buffered block swaps. Every element moves
+ *               roughly once and access stays sequential.
+ *
+ * Works for any trivially copyable element type (memcpy/memmove safe).
+ */
+
+class RotationEngine {
+public:
+    enum class Strategy { Auto, Buffered, Juggling, Reversal, BlockSwap };
+
+    static constexpr size_t BUFFER_BYTES = 64 * 1024;
+    static constexpr size_t CACHE_RESIDENT_BYTES = 1 << 20;
+
+    // Same result as RotateArray::rotate: element i moves to (i + k) % n
+    template <typename T>
+    static Strategy rotateRight(T* data, size_t n, size_t k, Strategy strategy = Strategy::Auto) {
+        static_assert(is_trivially_copyable<T>::value, "RotationEngine needs trivially copyable elements");
+        if (n == 0) return strategy;
+        k %= n;
+        if (k == 0) return strategy;
+        size_t d = n - k;  // Equivalent left rotation amount
+
+        if (strategy == Strategy::Auto) strategy = choose<T>(n, d);
+        switch (strategy) {
+            case Strategy::Buffered:  buffered(data, n, d); break;
+            case Strategy::Juggling:  juggling(data, n, d); break;
+            case Strategy::Reversal:
+                reverse(data, data + n);
+                reverse(data, data + k);
+                reverse(data + k, data + n);
+                break;
+            default:                  blockSwap(data, n, d); break;
+        }
+        return strategy;
+    }
+
+    template <typename T>
+    static Strategy rotateRight(vector<T>& nums, size_t k, Strategy strategy = Strategy::Auto) {
+        return rotateRight(nums.data(), nums.size(), k, strategy);
+    }
+
+    static const char* name(Strategy s) {
+        switch (s) {
+            case Strategy::Buffered:  return "Buffered";
+            case Strategy::Juggling:  return "Juggling";
+            case Strategy::Reversal:  return "Reversal";
+            case Strategy::BlockSwap: return "BlockSwap";
+            default:                  return "Auto";
+        }
+    }
+
+    // The strategy Auto picks for a left rotation by d
+    template <typename T>
+    static Strategy choose(size_t n, size_t d) {
+        if (min(d, n - d) * sizeof(T) <= BUFFER_BYTES) return Strategy::Buffered;
+        if (gcd(n, d) * sizeof(T) >= 64) return Strategy::Juggling;
+        if (n * sizeof(T) <= CACHE_RESIDENT_BYTES) return Strategy::Reversal;
+        return Strategy::BlockSwap;
+    }
+
+private:
+    static size_t gcd(size_t a, size_t b) {
+        while (b) { size_t t = a % b; a = b; b = t; }
+        return a;
+    }
+
+    // Left-rotate by d when one side fits in a small buffer
+    template <typename T>
+    static void buffered(T* a, size_t n, size_t d) {
+        if (d <= n - d) {
+            vector<T> saved(a, a + d);
+            memmove(a, a + d, (n - d) * sizeof(T));
+            memcpy(a + n - d, saved.data(), d * sizeof(T));
+        } else {
+            vector<T> saved(a + d, a + n);
+            memmove(a + (n - d), a, d * sizeof(T));
+            memcpy(a, saved.data(), (n - d) * sizeof(T));
+        }
+    }
+
+    // Cycle leader with L adjacent cycles moved together as one block
+    template <typename T>
+    static void juggling(T* a, size_t n, size_t d) {
+        size_t cycles = gcd(n, d);
+        size_t width = max<size_t>(1, min(cycles, BUFFER_BYTES / sizeof(T)));
+        vector<T> held(width);
+        for (size_t start = 0; start < cycles; start += width) {
+            size_t w = min(width, cycles - start);
+            memcpy(held.data(), a + start, w * sizeof(T));
+            size_t j = start;
+            while (true) {
+                size_t next = j + d >= n ? j + d - n : j + d;
+                if (next == start) break;
+                size_t after = next + d >= n ? next + d - n : next + d;
+                __builtin_prefetch(a + after);
+                memcpy(a + j, a + next, w * sizeof(T));
+                j = next;
+            }
+            memcpy(a + j, held.data(), w * sizeof(T));
+        }
+    }
+
+    // Swap two non-overlapping ranges through a fixed-size bounce buffer
+    template <typename T>
+    static void swapBlocks(T* x, T* y, size_t len) {
+        alignas(64) unsigned char bounce[4096];
+        size_t step = max<size_t>(1, sizeof(bounce) / sizeof(T));
+        if (sizeof(T) > sizeof(bounce)) {
+            swap_ranges(x, x + len, y);
+            return;
+        }
+        for (size_t i = 0; i < len; i += step) {
+            size_t bytes = min(step, len - i) * sizeof(T);
+            memcpy(bounce, x + i, bytes);
+            memcpy(x + i, y + i, bytes);
+            memcpy(y + i, bounce, bytes);
+        }
+    }
+
+    // Gries-Mills block swap: rotate left by d
+    template <typename T>
+    static void blockSwap(T* a, size_t n, size_t d) {
+        size_t i = d, j = n - d;
+        while (i != j) {
+            if (i < j) {
+                swapBlocks(a + d - i, a + d + j - i, i);
+                j -= i;
+            } else {
+                swapBlocks(a + d - i, a + d, j);
+                i -= j;
+            }
+        }
+        swapBlocks(a + d - i, a + d, i);
+    }
+};
+
+// Every strategy, every n up to maxN and every k in [0, 2n + 1] (so k = 0,
+// k = n and k > n) against std::rotate
+template <typename T>
+bool checkRotationStrategies(size_t maxN, T (*make)(size_t)) {
+    using S = RotationEngine::Strategy;
+    for (size_t n = 0; n <= maxN; ++n) {
+        vector<T> original(n);
+        for (size_t i = 0; i < n; ++i) original[i] = make(i);
+        for (size_t k = 0; k <= 2 * n + 1; ++k) {
+            vector<T> expected = original;
+            if (n > 0) rotate(expected.begin(), expected.begin() + (n - k % n) % n, expected.end());
+            for (S s : {S::Auto, S::Buffered, S::Juggling, S::Reversal, S::BlockSwap}) {
+                vector<T> data = original;
+                RotationEngine::rotateRight(data, k, s);
+                if (!equal(data.begin(), data.end(), expected.begin(),
+                           [](const T& x, const T& y) { return memcmp(&x, &y, sizeof(T)) == 0; })) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+// Elements wider than the 4 KB swap bounce buffer, and few enough per
+// 64 KB that juggling moves its cycles in several partial blocks
+struct WideElement { int tag; char payload[20000 - sizeof(int)]; };
+
+bool checkRotationEngine() {
+    bool ints = checkRotationStrategies<int>(64, [](size_t i) { return static_cast<int>(i); });
+    bool wide = checkRotationStrategies<WideElement>(24, [](size_t i) {
+        WideElement e{};
+        e.tag = static_cast<int>(i);
+        e.payload[i * 37 % sizeof(e.payload)] = static_cast<char>(i + 1);
+        return e;
+    });
+    return ints && wide;
+}
+
+// Rotation benchmark; pass 1 << 30 for the 1 GB run (needs ~2 GB of RAM)
+void benchmarkRotation(size_t bytes) {
+    size_t n = bytes / sizeof(int);
+    vector<int> data(n);
+    iota(data.begin(), data.end(), 0);
+
+    cout << "Rotation benchmark over " << (bytes >> 20) << " MB:" << endl;
+    for (size_t k : {size_t(1000), n / 3 + 7, n / 2}) {
+        auto time = [&](const char* label, auto&& fn) {
+            auto start = chrono::steady_clock::now();
+            fn();
+            double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+            bool ok = data[k % n] == 0 && data[(k + n - 1) % n] == static_cast<int>(n - 1);
+            cout << "  k=" << k << " " << label << ": " << ms << " ms"
+                 << (ok ? "" : " (WRONG)") << endl;
+            iota(data.begin(), data.end(), 0);
+        };
+        time("RotateArray::rotate", [&] { RotateArray::rotate(data, static_cast<int>(k)); });
+        for (auto s : {RotationEngine::Strategy::Juggling, RotationEngine::Strategy::Reversal,
+                       RotationEngine::Strategy::BlockSwap, RotationEngine::Strategy::Auto}) {
+            string label = string("RotationEngine ") + RotationEngine::name(s);
+            if (s == RotationEngine::Strategy::Auto) {
+                label += string(" -> ") + RotationEngine::name(RotationEngine::choose<int>(n, n - k % n));
+            }
+            time(label.c_str(), [&] { RotationEngine::rotateRight(data, k, s); });
+        }
+    }
+}
+
+// ========================================================================
+// PROBLEM 21: ROTATED SORTED INDEX WITH CACHED OFFSET (RING LOG) ⭐⭐⭐
+// ========================================================================
+/*
+ * Problems 7 and 8 rediscover the rotation point on every query. When
+ * many queries hit the same rotated buffer (e.g. a ring-buffered sorted
+ * log) the rotation offset should be found once and cached:
+ *
+ * - Logical index i (0 = smallest) maps to physical (head + i) mod n, so
+ *   the search is a plain branchless lower bound over logical indices.
+ * - Duplicates: the offset search falls back to shrinking the range when
+ *   nums[mid] == nums[right] (O(n) worst case, paid once), and lookups
+ *   return the first logical occurrence of the target.
+ * - Batched lookups advance a group of queries in lock-step so their
+ *   cache misses overlap.
+ * - As a ring log, appending past capacity overwrites the oldest entry
+ *   and advances head by one - the cached offset stays valid in O(1).
+ */
+
+class RotatedSortedIndex {
+private:
+    vector<int> ring;
+    size_t head = 0;      // Physical index of the smallest (oldest) entry
+    size_t count = 0;
+
+    size_t physical(size_t logical) const {
+        size_t p = head + logical;
+        return p >= ring.size() ? p - ring.size() : p;
+    }
+
+    // Start of the sorted order in a rotated array that may hold duplicates
+    static size_t findRotation(const vector<int>& nums) {
+        if (nums.empty()) return 0;
+        size_t left = 0, right = nums.size() - 1;
+        while (left < right) {
+            size_t mid = left + (right - left) / 2;
+            if (nums[mid] > nums[right]) {
+                left = mid + 1;
+            } else if (nums[mid] < nums[right]) {
+                right = mid;
+            } else {
+                if (nums[right - 1] > nums[right]) return right;
+                --right;
+            }
+        }
+        return left;
+    }
+
+public:
+    // Wrap an existing rotated sorted array (full ring)
+    explicit RotatedSortedIndex(vector<int> rotated)
+        : ring(move(rotated)), head(findRotation(ring)), count(ring.size()) {}
+
+    // Empty ring log with fixed capacity
+    static RotatedSortedIndex ringLog(size_t capacity) {
+        RotatedSortedIndex index({});
+        index.ring.resize(capacity);
+        return index;
+    }
+
+    size_t size() const { return count; }
+    size_t rotationOffset() const { return head; }
+    int at(size_t logical) const { return ring[physical(logical)]; }
+    int findMin() const {
+        if (count == 0) throw out_of_range("findMin on an empty ring log");
+        return ring[head];
+    }
+
+    // Append a value >= the current newest; evicts the oldest when full
+    bool append(int value) {
+        if (ring.empty() || (count > 0 && value < at(count - 1))) return false;
+        if (count < ring.size()) {
+            ring[physical(count++)] = value;
+        } else {
+            ring[head] = value;
+            head = head + 1 == ring.size() ? 0 : head + 1;
+        }
+        return true;
+    }
+
+    bool popOldest() {
+        if (count == 0) return false;
+        head = head + 1 == ring.size() ? 0 : head + 1;
+        --count;
+        return true;
+    }
+
+    // First logical index with value >= target (branchless)
+    size_t lowerBound(int target) const {
+        size_t base = 0, n = count;
+        while (n > 1) {
+            size_t half = n / 2;
+            base = at(base + half - 1) < target ? base + half : base;
+            n -= half;
+        }
+        return base + (n == 1 && at(base) < target);
+    }
+
+    // Physical index of the first occurrence, or -1
+    long long search(int target) const {
+        size_t i = lowerBound(target);
+        return (i < count && at(i) == target) ? static_cast<long long>(physical(i)) : -1;
+    }
+
+    vector<long long> batchSearch(const vector<int>& targets) const {
+        const size_t G = 16;
+        vector<long long> result(targets.size(), -1);
+        if (count == 0) return result;
+        for (size_t start = 0; start < targets.size(); start += G) {
+            size_t group = min(G, targets.size() - start);
+            size_t base[G] = {0};
+            size_t n = count;
+            while (n > 1) {
+                size_t half = n / 2;
+                for (size_t q = 0; q < group; ++q) __builtin_prefetch(&ring[physical(base[q] + half / 2)]);
+                for (size_t q = 0; q < group; ++q) {
+                    base[q] = at(base[q] + half - 1) < targets[start + q] ? base[q] + half : base[q];
+                }
+                n -= half;
+            }
+            for (size_t q = 0; q < group; ++q) {
+                size_t i = base[q] + (at(base[q]) < targets[start + q]);
+                if (i < count && at(i) == targets[start + q]) result[start + q] = static_cast<long long>(physical(i));
+            }
+        }
+        return result;
+    }
+};
+
 // ========================================================================
 // TESTING FUNCTIONS
 // ========================================================================
@@ -624,6 +2221,130 @@ void testArrayProblems() {
     // Test Trapping Rain Water
     vector<int> heights = {0, 1, 0, 2, 1, 0, 1, 3, 2, 1, 2, 1};
     cout << "Water Trapped: " << TrappingRainWater::trap(heights) << endl;
+    
+    // Test Parallel Maximum Subarray against Kadane's
+    vector<int> deltas(200000);
+    unsigned seed = 12345;
+    for (int& d : deltas) {
+        seed = seed * 1103515245 + 12345;
+        d = static_cast<int>((seed >> 16) % 2001) - 1000;
+    }
+    auto [bestSum, bestStart, bestEnd] = ParallelMaxSubarray::maxSubArrayWithRange(deltas, 4);
+    long long rangeSum = 0;
+    for (size_t i = bestStart; i <= bestEnd; i++) rangeSum += deltas[i];
+    bool parallelOk = bestSum == MaximumSubarray::maxSubArray(deltas) && rangeSum == bestSum;
+    cout << "Parallel Max Subarray: " << bestSum << " [" << bestStart << ".." << bestEnd << "] "
+         << (parallelOk ? "(matches Kadane)" : "(MISMATCH)") << endl;
+    
+    ChunkedMaxSubarray stream(1000);
+    for (size_t i = 0; i < deltas.size(); i += 1000) {
+        stream.appendChunk(vector<int>(deltas.begin() + i, deltas.begin() + i + 1000));
+    }
+    vector<int> correction(1000, 300);
+    stream.updateChunk(7, correction);
+    copy(correction.begin(), correction.end(), deltas.begin() + 7000);
+    cout << "Streaming Max Subarray after chunk update: " << stream.summary().best
+         << (stream.summary().best == MaximumSubarray::maxSubArray(deltas) ? " (matches)" : " (MISMATCH)") << endl;
+    
+    vector<vector<int>> matrix = {{1, 2, -1, -4, -20},
+                                  {-8, -3, 4, 2, 1},
+                                  {3, 8, 10, 1, 3},
+                                  {-4, -1, 1, 7, -6}};
+    auto rect = MaxSumSubmatrix::maxSumSubmatrix(matrix);
+    cout << "Max Sum Submatrix: " << rect.sum << " rows " << rect.top << ".." << rect.bottom
+         << ", cols " << rect.left << ".." << rect.right << endl;
+    cout << "Streaming Max Subarray / Max Sum Submatrix vs brute force (500 seeded cases): "
+         << (checkMaxSubarrayEngines(78, 500) ? "matches" : "MISMATCH") << endl;
+    
+    // Test Interval Engine
+    vector<Interval> packed = {{8, 10}, {1, 3}, {15, 18}, {2, 6}};
+    IntervalEngine::merge(packed);
+    cout << "Packed Merge Intervals: ";
+    for (auto& iv : packed) cout << "[" << iv.lo << "," << iv.hi << "] ";
+    cout << endl;
+    IntervalEngine::insert(packed, {4, 9});
+    cout << "Packed Insert [4,9]: ";
+    for (auto& iv : packed) cout << "[" << iv.lo << "," << iv.hi << "] ";
+    cout << endl;
+    
+    MergedIntervalSet calendar;
+    for (auto& iv : vector<Interval>{{1, 3}, {8, 10}, {15, 18}, {2, 6}, {11, 12}}) {
+        calendar.insert(iv.lo, iv.hi);
+    }
+    calendar.erase(16, 16);
+    Interval hit;
+    cout << "Merged Interval Set: " << calendar.size() << " spans, stab(5) -> ";
+    if (calendar.stab(5, &hit)) cout << "[" << hit.lo << "," << hit.hi << "]";
+    cout << ", overlaps(7,7) = " << (calendar.overlaps(7, 7) ? "yes" : "no")
+         << ", overlapping(9,17) = " << calendar.overlapping(9, 17).size() << " spans" << endl;
+    cout << "Merged Interval Set vs bitmap, endpoints at INT_MIN/0/INT_MAX (300 seeded cases): "
+         << (checkMergedIntervalSet(79, 300) ? "matches" : "MISMATCH") << endl;
+    
+    // Test K-Sum Engine
+    vector<int> orders = {-1, 0, 1, 2, -1, -4, 2, -2, 3};
+    KSumEngine engine(orders);
+    vector<int> triples = engine.kSum(3, 0, 2);
+    vector<int> ordersCopy = orders;
+    cout << "K-Sum Engine 3-sum: " << triples.size() / 3 << " triplets (ThreeSum found "
+         << ThreeSum::threeSum(ordersCopy).size() << "), 4-sum: "
+         << engine.kSum(4, 0).size() / 4 << " quadruplets" << endl;
+    auto joined = KSumEngine::hashJoinTwoSum({2, 7, 11, 15}, {7, 2, 0}, 9);
+    cout << "Hash Join Two Sum pairs:";
+    for (auto& [i, j] : joined) cout << " (" << i << "," << j << ")";
+    cout << endl;
+    cout << "K-Sum Engine / Hash Join vs brute force (500 seeded cases): "
+         << (checkKSumEngine(80, 500) ? "matches" : "MISMATCH") << endl;
+    
+    // Test Streaming Water / Histogram on chunks of the Problem 11 input
+    StreamingWater water;
+    StreamingHistogram histogram;
+    for (size_t i = 0; i < heights.size(); i += 5) {
+        size_t len = min<size_t>(5, heights.size() - i);
+        water.feed(heights.data() + i, len);
+        histogram.feed(heights.data() + i, len);
+    }
+    cout << "Streaming Water (chunks of 5): " << water.volume()
+         << ", Parallel Water: " << ParallelTerrain::trap(heights, 3)
+         << ", Largest Histogram Rectangle: " << histogram.largestRectangle() << endl;
+    
+    ByteRaster raster(4, 5);
+    const char* rasterRows[] = {"10100", "10111", "11111", "10010"};
+    for (int r = 0; r < 4; r++) {
+        for (int c = 0; c < 5; c++) raster.row(r)[c] = rasterRows[r][c] == '1';
+    }
+    cout << "Raster Maximal Rectangle (2 bands): " << RasterRectangle::maximalRectangle(raster, 2) << endl;
+    cout << "Streaming / Parallel / Raster engines vs brute force (500 seeded cases): "
+         << (checkTerrainEngines(81, 500) ? "matches" : "MISMATCH") << endl;
+    
+    // Test Rotation Engine against Problem 13
+    vector<int> rotated = {1, 2, 3, 4, 5, 6, 7};
+    vector<int> expected = rotated;
+    RotateArray::rotate(expected, 3);
+    auto used = RotationEngine::rotateRight(rotated, 3);
+    cout << "Rotation Engine (k=3, " << RotationEngine::name(used) << "): "
+         << (rotated == expected ? "matches RotateArray::rotate" : "MISMATCH") << endl;
+    cout << "Rotation Engine, all strategies vs std::rotate (n <= 64, every k): "
+         << (checkRotationEngine() ? "matches" : "MISMATCH") << endl;
+    benchmarkRotation(size_t(64) << 20);
+    
+    // Test Rotated Sorted Index against Problems 7 and 8
+    vector<int> rotatedLog = {4, 5, 6, 7, 0, 1, 2};
+    RotatedSortedIndex index(rotatedLog);
+    auto hits = index.batchSearch({0, 3, 7});
+    cout << "Rotated Index: offset " << index.rotationOffset() << ", min " << index.findMin()
+         << " (findMin " << FindMinimumRotated::findMin(rotatedLog) << "), search(0) = " << index.search(0)
+         << " (search " << SearchRotatedArray::search(rotatedLog, 0) << "), batch = ["
+         << hits[0] << ", " << hits[1] << ", " << hits[2] << "]" << endl;
+    RotatedSortedIndex ringLog = RotatedSortedIndex::ringLog(4);
+    for (int ts : {10, 20, 30, 40, 50, 60}) ringLog.append(ts);
+    cout << "Ring Log after 6 appends (capacity 4): min " << ringLog.findMin()
+         << ", offset " << ringLog.rotationOffset() << ", search(20) = " << ringLog.search(20) << endl;
+    RotatedSortedIndex emptyLog = RotatedSortedIndex::ringLog(0);
+    try {
+        emptyLog.findMin();
+    } catch (const out_of_range& e) {
+        cout << "Empty ring log findMin: " << e.what() << endl;
+    }
 }
 
 // ========================================================================
@@ -652,6 +2373,12 @@ int main() {
     cout << "13. Rotate Array ⭐" << endl;
     cout << "14. Merge Intervals ⭐⭐" << endl;
     cout << "15. Insert Interval ⭐⭐" << endl;
+    cout << "16. Maximum Subarray at Scale (Parallel) ⭐⭐⭐" << endl;
+    cout << "17. Interval Engine (Packed + Incremental) ⭐⭐⭐" << endl;
+    cout << "18. K-Sum Batch Engine (Flat + Hash Join) ⭐⭐⭐" << endl;
+    cout << "19. Streaming Rain Water & Histogram Engine ⭐⭐⭐" << endl;
+    cout << "20. Rotation Engine (Buffered / Juggling / Block Swap) ⭐⭐⭐" << endl;
+    cout << "21. Rotated Sorted Index (Cached Offset / Ring Log) ⭐⭐⭐" << endl;
     
     cout << "\nNext: Practice these problems and move to string_problems.cpp!" << endl;
     
@@ -659,7 +2386,7 @@ int main() {
 }
 
 /*
- * COMPILATION: g++ -std=c++17 -O2 -o array_problems array_problems.cpp
+ * COMPILATION: g++ -std=c++17 -O2 -pthread -o array_problems array_problems.cpp
  * 
  * STUDY TIPS:
  * 1. Start with easy problems (⭐) and understand the basic patterns
@@ -24,6 +24,16 @@
 #include <vector>
 #include <stdexcept>
 #include <algorithm>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <memory>
+#include <chrono>
+#include <iomanip>
+#include <cstdint>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
 
 using namespace std;
 
@@ -798,6 +808,398 @@ public:
     }
 };
 
+/*
+ * ========================================================================
+ * ARENA-BACKED CIRCULAR LISTS (32-BIT HANDLES)
+ * ========================================================================
+ * 
+ * The circular lists above allocate every node with new and clear() must
+ * walk the whole ring to delete it. Here nodes live in a HandleArena: one
+ * vector addressed by uint32_t handles, with released nodes kept on a free
+ * list threaded through their next field.
+ * - Nodes are smaller (4-byte links instead of 8-byte pointers, no heap
+ *   header) and sit contiguously in insertion order.
+ * - A ring is a chain once it is cut at the tail, so clear() hands the
+ *   whole ring to the free list in O(1).
+ * - Several lists can share one arena.
+ * - Released slots keep their old value until reused.
+ */
+
+template<typename Node>
+class HandleArena {
+private:
+    vector<Node> nodes;
+    uint32_t freeHead;
+    size_t live = 0;
+    
+public:
+    static constexpr uint32_t NIL = UINT32_MAX;
+    
+    HandleArena() : freeHead(NIL) {}
+    
+    uint32_t allocate() {
+        if (freeHead != NIL) {
+            uint32_t handle = freeHead;
+            freeHead = nodes[handle].next;
+            live++;
+            return handle;
+        }
+        if (nodes.size() >= NIL) throw length_error("Arena is out of handles");
+        nodes.emplace_back();  // Counted only once it succeeded
+        live++;
+        return static_cast<uint32_t>(nodes.size() - 1);
+    }
+    
+    void release(uint32_t handle) {
+        nodes[handle].next = freeHead;
+        freeHead = handle;
+        live--;
+    }
+    
+    // Returns a chain first..last of count nodes linked through next - O(1)
+    void releaseChain(uint32_t first, uint32_t last, size_t count) {
+        nodes[last].next = freeHead;
+        freeHead = first;
+        live -= count;
+    }
+    
+    Node& operator[](uint32_t handle) { return nodes[handle]; }
+    const Node& operator[](uint32_t handle) const { return nodes[handle]; }
+    
+    size_t live_nodes() const { return live; }
+    size_t bytes_reserved() const { return nodes.capacity() * sizeof(Node); }
+};
+
+template<typename T>
+class ArenaCircularSinglyLinkedList {
+public:
+    struct Node {
+        T data;
+        uint32_t next;
+    };
+    using Arena = HandleArena<Node>;
+    static constexpr uint32_t NIL = Arena::NIL;
+    
+private:
+    unique_ptr<Arena> owned_arena;
+    Arena* arena;
+    uint32_t tail = NIL;  // tail's next is the head
+    size_t list_size = 0;
+    
+    Node& at(uint32_t handle) const { return (*arena)[handle]; }
+    
+    uint32_t new_node(const T& value) {
+        uint32_t handle = arena->allocate();
+        at(handle).data = value;
+        return handle;
+    }
+    
+public:
+    ArenaCircularSinglyLinkedList() : owned_arena(new Arena), arena(owned_arena.get()) {}
+    explicit ArenaCircularSinglyLinkedList(Arena& shared) : arena(&shared) {}
+    
+    ~ArenaCircularSinglyLinkedList() {
+        clear();
+    }
+    
+    ArenaCircularSinglyLinkedList(const ArenaCircularSinglyLinkedList&) = delete;
+    ArenaCircularSinglyLinkedList& operator=(const ArenaCircularSinglyLinkedList&) = delete;
+    
+    bool empty() const { return tail == NIL; }
+    size_t size() const { return list_size; }
+    
+    const T& front() const {
+        if (empty()) throw std::runtime_error("List is empty");
+        return at(at(tail).next).data;
+    }
+    
+    const T& back() const {
+        if (empty()) throw std::runtime_error("List is empty");
+        return at(tail).data;
+    }
+    
+    // O(1)
+    void push_front(const T& value) {
+        uint32_t handle = new_node(value);
+        if (empty()) {
+            at(handle).next = handle;
+            tail = handle;
+        } else {
+            at(handle).next = at(tail).next;
+            at(tail).next = handle;
+        }
+        list_size++;
+    }
+    
+    // O(1): insert at the front, then advance the tail onto it
+    void push_back(const T& value) {
+        push_front(value);
+        tail = at(tail).next;
+    }
+    
+    // O(1)
+    void pop_front() {
+        if (empty()) throw std::runtime_error("List is empty");
+        uint32_t head = at(tail).next;
+        if (head == tail) {
+            tail = NIL;
+        } else {
+            at(tail).next = at(head).next;
+        }
+        arena->release(head);
+        list_size--;
+    }
+    
+    // O(n): the node before the tail has to be found
+    void pop_back() {
+        if (empty()) throw std::runtime_error("List is empty");
+        if (list_size == 1) return pop_front();
+        uint32_t prev = at(tail).next;
+        while (at(prev).next != tail) prev = at(prev).next;
+        at(prev).next = at(tail).next;
+        arena->release(tail);
+        tail = prev;
+        list_size--;
+    }
+    
+    // Moves the first k elements to the back - O(k)
+    void rotate(size_t k) {
+        if (empty()) return;
+        for (k %= list_size; k > 0; k--) tail = at(tail).next;
+    }
+    
+    bool contains(const T& value) const {
+        if (empty()) return false;
+        uint32_t handle = tail;
+        do {
+            handle = at(handle).next;
+            if (at(handle).data == value) return true;
+        } while (handle != tail);
+        return false;
+    }
+    
+    // O(1): cut the ring after the tail and free it as one chain
+    void clear() {
+        if (empty()) return;
+        arena->releaseChain(at(tail).next, tail, list_size);
+        tail = NIL;
+        list_size = 0;
+    }
+    
+    vector<T> to_vector() const {
+        vector<T> result;
+        if (empty()) return result;
+        result.reserve(list_size);
+        uint32_t handle = tail;
+        do {
+            handle = at(handle).next;
+            result.push_back(at(handle).data);
+        } while (handle != tail);
+        return result;
+    }
+    
+    void display() const {
+        if (empty()) {
+            cout << "List is empty" << endl;
+            return;
+        }
+        cout << "Arena circular list: ";
+        for (const T& value : to_vector()) cout << value << " -> ";
+        cout << "(back to " << front() << ")" << endl;
+    }
+    
+    const Arena& get_arena() const { return *arena; }
+};
+
+template<typename T>
+class ArenaCircularDoublyLinkedList {
+public:
+    struct Node {
+        T data;
+        uint32_t prev;
+        uint32_t next;
+    };
+    using Arena = HandleArena<Node>;
+    static constexpr uint32_t NIL = Arena::NIL;
+    
+private:
+    unique_ptr<Arena> owned_arena;
+    Arena* arena;
+    uint32_t head = NIL;
+    size_t list_size = 0;
+    
+    Node& at(uint32_t handle) const { return (*arena)[handle]; }
+    
+    // Links a new node just before head (that is, at the back)
+    uint32_t link_before_head(const T& value) {
+        uint32_t handle = arena->allocate();
+        Node& node = at(handle);
+        node.data = value;
+        if (head == NIL) {
+            node.prev = node.next = handle;
+            head = handle;
+        } else {
+            uint32_t tail = at(head).prev;
+            node.prev = tail;
+            node.next = head;
+            at(tail).next = handle;
+            at(head).prev = handle;
+        }
+        list_size++;
+        return handle;
+    }
+    
+    void unlink(uint32_t handle) {
+        if (list_size == 1) {
+            head = NIL;
+        } else {
+            Node& node = at(handle);
+            at(node.prev).next = node.next;
+            at(node.next).prev = node.prev;
+            if (handle == head) head = node.next;
+        }
+        arena->release(handle);
+        list_size--;
+    }
+    
+public:
+    ArenaCircularDoublyLinkedList() : owned_arena(new Arena), arena(owned_arena.get()) {}
+    explicit ArenaCircularDoublyLinkedList(Arena& shared) : arena(&shared) {}
+    
+    ~ArenaCircularDoublyLinkedList() {
+        clear();
+    }
+    
+    ArenaCircularDoublyLinkedList(const ArenaCircularDoublyLinkedList&) = delete;
+    ArenaCircularDoublyLinkedList& operator=(const ArenaCircularDoublyLinkedList&) = delete;
+    
+    bool empty() const { return head == NIL; }
+    size_t size() const { return list_size; }
+    
+    const T& front() const {
+        if (empty()) throw std::runtime_error("List is empty");
+        return at(head).data;
+    }
+    
+    const T& back() const {
+        if (empty()) throw std::runtime_error("List is empty");
+        return at(at(head).prev).data;
+    }
+    
+    // All four ends are O(1)
+    void push_back(const T& value) { link_before_head(value); }
+    void push_front(const T& value) { head = link_before_head(value); }
+    
+    void pop_front() {
+        if (empty()) throw std::runtime_error("List is empty");
+        unlink(head);
+    }
+    
+    void pop_back() {
+        if (empty()) throw std::runtime_error("List is empty");
+        unlink(at(head).prev);
+    }
+    
+    // Rotates by k (negative k rotates backward) - O(min(|k|, n))
+    void rotate(long long k) {
+        if (empty()) return;
+        k %= static_cast<long long>(list_size);
+        for (; k > 0; k--) head = at(head).next;
+        for (; k < 0; k++) head = at(head).prev;
+    }
+    
+    // O(1): the ring is cut at the tail and freed as one chain
+    void clear() {
+        if (empty()) return;
+        arena->releaseChain(head, at(head).prev, list_size);
+        head = NIL;
+        list_size = 0;
+    }
+    
+    vector<T> to_vector() const {
+        vector<T> result;
+        if (empty()) return result;
+        result.reserve(list_size);
+        uint32_t handle = head;
+        do {
+            result.push_back(at(handle).data);
+            handle = at(handle).next;
+        } while (handle != head);
+        return result;
+    }
+    
+    void display_forward() const {
+        if (empty()) {
+            cout << "List is empty" << endl;
+            return;
+        }
+        cout << "Forward: ";
+        for (const T& value : to_vector()) cout << value << " <-> ";
+        cout << "(back to " << front() << ")" << endl;
+    }
+    
+    const Arena& get_arena() const { return *arena; }
+};
+
+// Bytes currently allocated from the heap, where the C library can report it
+size_t heap_bytes_in_use() {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    return mallinfo2().uordblks;
+#else
+    return 0;
+#endif
+}
+
+void benchmarkArenaCircularLists() {
+    cout << "\n--- Arena vs heap circular lists ---" << endl;
+    const int N = 2000000;
+    
+    auto time_ms = [](auto&& fn) {
+        auto start = chrono::steady_clock::now();
+        fn();
+        return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    };
+    
+    // Fill, copy out by walking the ring, clear, then fill again
+    auto run = [&](auto& list, const char* name, auto bytes_of_arena) {
+        size_t heap_before = heap_bytes_in_use();
+        double fill = time_ms([&] { for (int i = 0; i < N; i++) list.push_back(i); });
+        double bytes = bytes_of_arena(list);
+        if (bytes < 0) bytes = static_cast<double>(heap_bytes_in_use() - heap_before) / N;
+        vector<int> values;
+        double walk = time_ms([&] { values = list.to_vector(); });
+        double clear = time_ms([&] { list.clear(); });
+        double refill = time_ms([&] { for (int i = 0; i < N; i++) list.push_back(i); });
+        list.clear();
+        cout << "  " << left << setw(26) << name << right << fixed << setprecision(1) << setw(8) << bytes
+             << setw(10) << fill << setw(10) << walk << setprecision(3) << setw(10) << clear
+             << setprecision(1) << setw(10) << refill << (values.back() == N - 1 ? "" : "  MISMATCH") << endl;
+    };
+    auto from_heap = [](auto&) { return -1.0; };
+    auto from_arena = [&](auto& list) { return static_cast<double>(list.get_arena().bytes_reserved()) / N; };
+    
+    cout << "  " << N << " push_back, walk to vector, clear, refill (bytes/node, ms):" << endl;
+    cout << "  " << left << setw(26) << "" << right << setw(8) << "bytes" << setw(10) << "fill"
+         << setw(10) << "walk" << setw(10) << "clear" << setw(10) << "refill" << endl;
+    {
+        CircularSinglyLinkedList<int> list;
+        run(list, "CircularSinglyLinkedList", from_heap);
+    }
+    {
+        ArenaCircularSinglyLinkedList<int> list;
+        run(list, "Arena circular singly", from_arena);
+    }
+    {
+        CircularDoublyLinkedList<int> list;
+        run(list, "CircularDoublyLinkedList", from_heap);
+    }
+    {
+        ArenaCircularDoublyLinkedList<int> list;
+        run(list, "Arena circular doubly", from_arena);
+    }
+    cout << defaultfloat << setprecision(6);
+}
+
 /*
  * ========================================================================
  * CIRCULAR LINKED LIST APPLICATIONS
@@ -891,6 +1293,712 @@ public:
     }
 };
 
+/*
+ * Application 3: Concurrent Ready Queues
+ * RoundRobinScheduler above runs on one thread. With many producer threads
+ * submitting work, a mutex around the list serializes every push and pop.
+ * 
+ * MPMCBoundedQueue (Dmitry Vyukov's bounded MPMC queue):
+ * - A power-of-two ring of cells, each with its own sequence number.
+ * - A producer claims position pos with one CAS on the enqueue counter
+ *   when cell[pos].sequence == pos, writes the value, then publishes it
+ *   with sequence = pos + 1. A consumer waits for pos + 1, reads, and
+ *   frees the cell for the next lap with sequence = pos + capacity.
+ * - No allocation after construction; the two counters live on separate
+ *   cache lines so producers and consumers do not false-share.
+ * 
+ * MichaelScottQueue (unbounded lock-free linked queue):
+ * - Singly linked list with a dummy head; push CASes tail->next then
+ *   swings tail, pop CASes head forward (helping a lagging tail).
+ * - A popped node may still be read by a concurrent thread, so it is
+ *   retired through hazard pointers instead of deleted: each thread
+ *   publishes the nodes it is about to dereference, and retired nodes
+ *   are freed only once no hazard pointer refers to them.
+ */
+
+class HazardPointers {
+public:
+    static constexpr int MAX_THREADS = 128;
+    static constexpr int PER_THREAD = 2;
+    static constexpr size_t SCAN_THRESHOLD = 2 * MAX_THREADS * PER_THREAD;
+    
+    static HazardPointers& instance() {
+        static HazardPointers domain;
+        return domain;
+    }
+    
+    atomic<void*>& slot(int i) {
+        return owner().record->hazard[i];
+    }
+    
+    // Publishes src's current value in hazard slot i and returns it once stable
+    template<typename T>
+    T* protect(int i, const atomic<T*>& src) {
+        atomic<void*>& hazard = slot(i);
+        T* p = src.load();
+        while (true) {
+            hazard.store(p);
+            T* again = src.load();
+            if (again == p) return p;
+            p = again;
+        }
+    }
+    
+    void clear(int i) {
+        slot(i).store(nullptr, memory_order_release);
+    }
+    
+    template<typename T>
+    void retire(T* p) {
+        Owner& o = owner();
+        o.retired.push_back({p, [](void* q) { delete static_cast<T*>(q); }});
+        if (o.retired.size() >= SCAN_THRESHOLD) {
+            adoptOrphans(o.retired);
+            scan(o.retired);
+        }
+    }
+    
+    // Nodes left behind by exited threads and not yet adopted by a scan
+    size_t orphanCount() {
+        lock_guard<mutex> lock(orphanMutex);
+        return orphans.size();
+    }
+    
+    ~HazardPointers() {
+        for (auto& r : orphans) r.deleter(r.pointer);
+    }
+
+private:
+    struct alignas(64) Record {
+        atomic<bool> active{false};
+        atomic<void*> hazard[PER_THREAD] = {};
+    };
+    
+    struct Retired {
+        void* pointer;
+        void (*deleter)(void*);
+    };
+    
+    // Per-thread registration; releases the record when the thread exits
+    struct Owner {
+        Record* record = nullptr;
+        vector<Retired> retired;
+        
+        ~Owner() {
+            if (!record) return;
+            HazardPointers& domain = HazardPointers::instance();
+            for (auto& h : record->hazard) h.store(nullptr);
+            domain.adoptOrphans(retired);
+            domain.scan(retired);
+            lock_guard<mutex> lock(domain.orphanMutex);
+            domain.orphans.insert(domain.orphans.end(), retired.begin(), retired.end());
+            record->active.store(false);
+        }
+    };
+    
+    Record records[MAX_THREADS];
+    mutex orphanMutex;
+    vector<Retired> orphans;
+    
+    Owner& owner() {
+        thread_local Owner o;
+        if (!o.record) {
+            for (auto& r : records) {
+                bool expected = false;
+                if (r.active.compare_exchange_strong(expected, true)) {
+                    o.record = &r;
+                    break;
+                }
+            }
+            if (!o.record) throw runtime_error("Too many threads using hazard pointers");
+        }
+        return o;
+    }
+    
+    // Exited threads cannot scan again, so the next scan of any thread (a
+    // live one, or one exiting) takes over their still-protected nodes;
+    // otherwise thread churn leaks them until the domain is destroyed
+    void adoptOrphans(vector<Retired>& retired) {
+        lock_guard<mutex> lock(orphanMutex);
+        retired.insert(retired.end(), orphans.begin(), orphans.end());
+        orphans.clear();
+    }
+    
+    // Frees every retired node that no thread currently protects
+    void scan(vector<Retired>& retired) {
+        vector<void*> hazards;
+        for (auto& r : records) {
+            if (!r.active.load()) continue;
+            for (auto& h : r.hazard) {
+                if (void* p = h.load()) hazards.push_back(p);
+            }
+        }
+        sort(hazards.begin(), hazards.end());
+        size_t kept = 0;
+        for (auto& r : retired) {
+            if (binary_search(hazards.begin(), hazards.end(), r.pointer)) {
+                retired[kept++] = r;
+            } else {
+                r.deleter(r.pointer);
+            }
+        }
+        retired.resize(kept);
+    }
+};
+
+template<typename T>
+class MPMCBoundedQueue {
+private:
+    struct Cell {
+        atomic<size_t> sequence;
+        T data;
+    };
+    
+    unique_ptr<Cell[]> cells;
+    size_t mask;
+    alignas(64) atomic<size_t> enqueuePos{0};
+    alignas(64) atomic<size_t> dequeuePos{0};
+    char padding[64 - sizeof(atomic<size_t>)];
+
+public:
+    explicit MPMCBoundedQueue(size_t capacity) {
+        if (capacity < 2 || (capacity & (capacity - 1))) {
+            throw invalid_argument("Capacity must be a power of two >= 2");
+        }
+        cells.reset(new Cell[capacity]);
+        mask = capacity - 1;
+        for (size_t i = 0; i < capacity; ++i) cells[i].sequence.store(i, memory_order_relaxed);
+    }
+    
+    MPMCBoundedQueue(const MPMCBoundedQueue&) = delete;
+    MPMCBoundedQueue& operator=(const MPMCBoundedQueue&) = delete;
+    
+    // Returns false when the queue is full
+    bool tryPush(const T& value) {
+        size_t pos = enqueuePos.load(memory_order_relaxed);
+        Cell* cell;
+        while (true) {
+            cell = &cells[pos & mask];
+            size_t seq = cell->sequence.load(memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueuePos.load(memory_order_relaxed);
+            }
+        }
+        cell->data = value;
+        cell->sequence.store(pos + 1, memory_order_release);
+        return true;
+    }
+    
+    // Returns false when the queue is empty
+    bool tryPop(T& value) {
+        size_t pos = dequeuePos.load(memory_order_relaxed);
+        Cell* cell;
+        while (true) {
+            cell = &cells[pos & mask];
+            size_t seq = cell->sequence.load(memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (dequeuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = dequeuePos.load(memory_order_relaxed);
+            }
+        }
+        value = move(cell->data);
+        cell->sequence.store(pos + mask + 1, memory_order_release);
+        return true;
+    }
+    
+    size_t capacity() const { return mask + 1; }
+};
+
+template<typename T>
+class MichaelScottQueue {
+private:
+    struct Node {
+        T data;
+        atomic<Node*> next{nullptr};
+        
+        Node() : data() {}
+        explicit Node(const T& value) : data(value) {}
+    };
+    
+    alignas(64) atomic<Node*> head;
+    alignas(64) atomic<Node*> tail;
+
+public:
+    MichaelScottQueue() {
+        Node* dummy = new Node();
+        head.store(dummy);
+        tail.store(dummy);
+    }
+    
+    ~MichaelScottQueue() {
+        Node* node = head.load();
+        while (node) {
+            Node* next = node->next.load();
+            delete node;
+            node = next;
+        }
+    }
+    
+    MichaelScottQueue(const MichaelScottQueue&) = delete;
+    MichaelScottQueue& operator=(const MichaelScottQueue&) = delete;
+    
+    // Unbounded: always succeeds
+    bool tryPush(const T& value) {
+        HazardPointers& hp = HazardPointers::instance();
+        Node* node = new Node(value);
+        while (true) {
+            Node* t = hp.protect(0, tail);
+            Node* next = t->next.load();
+            if (t != tail.load()) continue;
+            if (next) {
+                // Tail is lagging: help swing it forward
+                tail.compare_exchange_weak(t, next);
+                continue;
+            }
+            Node* expected = nullptr;
+            if (t->next.compare_exchange_weak(expected, node)) {
+                tail.compare_exchange_strong(t, node);
+                break;
+            }
+        }
+        hp.clear(0);
+        return true;
+    }
+    
+    bool tryPop(T& value) {
+        HazardPointers& hp = HazardPointers::instance();
+        while (true) {
+            Node* h = hp.protect(0, head);
+            Node* t = tail.load();
+            Node* next = hp.protect(1, h->next);
+            if (h != head.load()) continue;
+            if (!next) {
+                hp.clear(0);
+                hp.clear(1);
+                return false;
+            }
+            if (h == t) {
+                tail.compare_exchange_weak(t, next);
+                continue;
+            }
+            // next becomes the new dummy; its data is read while protected
+            value = next->data;
+            if (head.compare_exchange_weak(h, next)) {
+                hp.clear(0);
+                hp.clear(1);
+                hp.retire(h);
+                return true;
+            }
+        }
+    }
+};
+
+// Baseline: the existing circular list behind a mutex
+template<typename T>
+class LockedListQueue {
+private:
+    CircularSinglyLinkedList<T> list;
+    mutex lock;
+
+public:
+    bool tryPush(const T& value) {
+        lock_guard<mutex> guard(lock);
+        list.push_back(value);
+        return true;
+    }
+    
+    bool tryPop(T& value) {
+        lock_guard<mutex> guard(lock);
+        if (list.empty()) return false;
+        value = list.front();
+        list.pop_front();
+        return true;
+    }
+};
+
+/*
+ * Application 4: Multi-threaded Round Robin Scheduler
+ * Producers submit processes into a shared ready queue; worker threads pop
+ * one, run it for a quantum and requeue it until its burst is used up.
+ * Works with any queue of ScheduledProcess offering tryPush/tryPop.
+ */
+struct ScheduledProcess {
+    int id = 0;
+    int remaining_time = 0;
+};
+
+template<typename Queue>
+class ConcurrentRoundRobinScheduler {
+public:
+    struct Stats {
+        int completed = 0;
+        long long quanta = 0;
+        double milliseconds = 0;
+    };
+
+private:
+    Queue& ready_queue;
+    int time_quantum;
+    
+    // Stand-in for running a process: a little CPU work per time unit
+    static void execute(int units) {
+        volatile int sink = 0;
+        for (int i = 0; i < units * 16; ++i) sink = sink + i;
+    }
+
+public:
+    ConcurrentRoundRobinScheduler(Queue& queue, int quantum) : ready_queue(queue), time_quantum(quantum) {}
+    
+    // processes holds (id, burst_time) pairs, split round-robin across producers
+    Stats run(const vector<pair<int, int>>& processes, int producers, int workers) {
+        atomic<int> completed{0};
+        atomic<long long> quanta{0};
+        int total = processes.size();
+        auto start = chrono::steady_clock::now();
+        
+        vector<thread> threads;
+        for (int p = 0; p < producers; ++p) {
+            threads.emplace_back([&, p] {
+                for (int i = p; i < total; i += producers) {
+                    ScheduledProcess process{processes[i].first, processes[i].second};
+                    while (!ready_queue.tryPush(process)) this_thread::yield();
+                }
+            });
+        }
+        for (int w = 0; w < workers; ++w) {
+            threads.emplace_back([&] {
+                long long local_quanta = 0;
+                ScheduledProcess process;
+                while (completed.load(memory_order_relaxed) < total) {
+                    if (!ready_queue.tryPop(process)) {
+                        this_thread::yield();
+                        continue;
+                    }
+                    // If the queue is full, keep running the process instead of blocking
+                    do {
+                        int slice = min(process.remaining_time, time_quantum);
+                        execute(slice);
+                        process.remaining_time -= slice;
+                        ++local_quanta;
+                    } while (process.remaining_time > 0 && !ready_queue.tryPush(process));
+                    if (process.remaining_time == 0) completed.fetch_add(1);
+                }
+                quanta.fetch_add(local_quanta);
+            });
+        }
+        for (auto& t : threads) t.join();
+        
+        Stats stats;
+        stats.completed = completed.load();
+        stats.quanta = quanta.load();
+        stats.milliseconds = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        return stats;
+    }
+};
+
+// Items per second through each queue for several producer/consumer mixes
+void benchmarkConcurrentQueues() {
+    cout << "=== CONCURRENT QUEUE THROUGHPUT ===" << endl;
+    const int ITEMS = 1 << 19;
+    
+    auto measure = [&](auto& queue, int producers, int consumers) {
+        atomic<long long> consumed{0}, checksum{0};
+        auto start = chrono::steady_clock::now();
+        vector<thread> threads;
+        for (int p = 0; p < producers; ++p) {
+            threads.emplace_back([&, p] {
+                for (int i = p; i < ITEMS; i += producers) {
+                    while (!queue.tryPush(i)) this_thread::yield();
+                }
+            });
+        }
+        for (int c = 0; c < consumers; ++c) {
+            threads.emplace_back([&] {
+                long long local = 0;
+                int value;
+                while (consumed.load(memory_order_relaxed) < ITEMS) {
+                    if (queue.tryPop(value)) {
+                        local += value;
+                        consumed.fetch_add(1, memory_order_relaxed);
+                    } else {
+                        this_thread::yield();
+                    }
+                }
+                checksum.fetch_add(local);
+            });
+        }
+        for (auto& t : threads) t.join();
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        bool ok = checksum.load() == static_cast<long long>(ITEMS) * (ITEMS - 1) / 2;
+        return make_pair(ITEMS / seconds / 1e6, ok);
+    };
+    
+    cout << ITEMS << " items, million items/s (" << thread::hardware_concurrency() << " hardware threads):" << endl;
+    cout << setw(10) << "prod/cons" << setw(14) << "LockedList" << setw(14) << "MPMCBounded" << setw(14) << "MichaelScott" << endl;
+    cout << fixed << setprecision(2);
+    for (auto [producers, consumers] : vector<pair<int, int>>{{1, 1}, {2, 2}, {4, 4}, {1, 4}, {4, 1}}) {
+        LockedListQueue<int> locked;
+        MPMCBoundedQueue<int> bounded(1024);
+        MichaelScottQueue<int> linked;
+        auto a = measure(locked, producers, consumers);
+        auto b = measure(bounded, producers, consumers);
+        auto c = measure(linked, producers, consumers);
+        cout << setw(6) << producers << "/" << consumers << "  " << setw(14) << a.first << setw(14) << b.first
+             << setw(14) << c.first << (a.second && b.second && c.second ? "" : "  MISMATCH") << endl;
+    }
+    cout << defaultfloat << setprecision(6) << endl;
+}
+
+/*
+ * Application 5: SPSC Ring Buffer
+ * The circular lists above model a ring with heap nodes. A pipeline stage
+ * with exactly one producer and one consumer only needs an array ring:
+ * 
+ * - Power-of-two capacity: positions grow forever and index with & mask,
+ *   so full/empty never need a wasted slot or a wrap flag.
+ * - Wait-free: the producer only stores tail, the consumer only stores
+ *   head; each publishes with one release store, no CAS or retry loop.
+ * - Cached indices: the producer keeps its last view of head (and the
+ *   consumer of tail) on its own cache line and rereads the shared
+ *   counter only when the cached view says full (empty). The lines then
+ *   move between cores once per batch instead of once per message.
+ * - Span batches and zero-copy reserve/commit let a writer fill the ring
+ *   in place and publish many slots with a single store.
+ */
+template<typename T>
+class SPSCRingBuffer {
+public:
+    struct Span {
+        T* data;
+        size_t count;
+    };
+
+private:
+    unique_ptr<T[]> buffer;
+    size_t mask;
+    
+    // Consumer's line: read position and its view of the producer
+    alignas(64) atomic<size_t> head{0};
+    size_t cachedTail = 0;
+    
+    // Producer's line: write position and its view of the consumer
+    alignas(64) atomic<size_t> tail{0};
+    size_t cachedHead = 0;
+    char padding[64 - sizeof(atomic<size_t>) - sizeof(size_t)];
+    
+    size_t freeSlots(size_t t) {
+        if (t - cachedHead == capacity()) cachedHead = head.load(memory_order_acquire);
+        return capacity() - (t - cachedHead);
+    }
+    
+    size_t readySlots(size_t h) {
+        if (cachedTail == h) cachedTail = tail.load(memory_order_acquire);
+        return cachedTail - h;
+    }
+
+public:
+    explicit SPSCRingBuffer(size_t capacity) {
+        if (capacity < 2 || (capacity & (capacity - 1))) {
+            throw invalid_argument("Capacity must be a power of two >= 2");
+        }
+        buffer.reset(new T[capacity]);
+        mask = capacity - 1;
+    }
+    
+    SPSCRingBuffer(const SPSCRingBuffer&) = delete;
+    SPSCRingBuffer& operator=(const SPSCRingBuffer&) = delete;
+    
+    size_t capacity() const { return mask + 1; }
+    
+    // Approximate when called concurrently
+    size_t size() const { return tail.load(memory_order_acquire) - head.load(memory_order_acquire); }
+    
+    // ---- Producer side ----
+    
+    bool tryPush(const T& value) {
+        size_t t = tail.load(memory_order_relaxed);
+        if (freeSlots(t) == 0) return false;
+        buffer[t & mask] = value;
+        tail.store(t + 1, memory_order_release);
+        return true;
+    }
+    
+    // Copies up to count values; returns how many fit
+    size_t pushBatch(const T* values, size_t count) {
+        size_t t = tail.load(memory_order_relaxed);
+        count = min(count, freeSlots(t));
+        size_t first = min(count, capacity() - (t & mask));
+        copy(values, values + first, buffer.get() + (t & mask));
+        copy(values + first, values + count, buffer.get());
+        tail.store(t + count, memory_order_release);
+        return count;
+    }
+    
+    // Contiguous writable slots (up to want, stopping at the wrap point)
+    Span reserve(size_t want) {
+        size_t t = tail.load(memory_order_relaxed);
+        size_t count = min({want, freeSlots(t), capacity() - (t & mask)});
+        return {buffer.get() + (t & mask), count};
+    }
+    
+    // Publishes the first n slots of the last reserve()
+    void commit(size_t n) {
+        tail.store(tail.load(memory_order_relaxed) + n, memory_order_release);
+    }
+    
+    // ---- Consumer side ----
+    
+    bool tryPop(T& value) {
+        size_t h = head.load(memory_order_relaxed);
+        if (readySlots(h) == 0) return false;
+        value = move(buffer[h & mask]);
+        head.store(h + 1, memory_order_release);
+        return true;
+    }
+    
+    size_t popBatch(T* out, size_t maxCount) {
+        size_t h = head.load(memory_order_relaxed);
+        size_t count = min(maxCount, readySlots(h));
+        size_t first = min(count, capacity() - (h & mask));
+        move(buffer.get() + (h & mask), buffer.get() + (h & mask) + first, out);
+        move(buffer.get(), buffer.get() + (count - first), out + first);
+        head.store(h + count, memory_order_release);
+        return count;
+    }
+    
+    // Contiguous readable slots, consumed in place and freed with release()
+    Span peek() {
+        size_t h = head.load(memory_order_relaxed);
+        size_t count = min(readySlots(h), capacity() - (h & mask));
+        return {buffer.get() + (h & mask), count};
+    }
+    
+    void release(size_t n) {
+        head.store(head.load(memory_order_relaxed) + n, memory_order_release);
+    }
+};
+
+// Messages per second between one producer and one consumer thread
+void benchmarkSPSCRingBuffer() {
+    cout << "=== SPSC RING BUFFER THROUGHPUT ===" << endl;
+    const uint64_t MESSAGES = 1 << 25;
+    const size_t BATCH = 256;
+    
+    auto measure = [&](auto&& producer, auto&& consumer) {
+        auto start = chrono::steady_clock::now();
+        uint64_t sum = 0;
+        thread p(producer);
+        thread c([&] { sum = consumer(); });
+        p.join();
+        c.join();
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        bool ok = sum == MESSAGES * (MESSAGES - 1) / 2;
+        cout << setw(10) << MESSAGES / seconds / 1e6 << " M msg/s" << (ok ? "" : "  MISMATCH") << endl;
+    };
+    
+    cout << MESSAGES << " uint64 messages, capacity 4096 (" << thread::hardware_concurrency()
+         << " hardware threads):" << endl;
+    cout << fixed << setprecision(2);
+    {
+        SPSCRingBuffer<uint64_t> ring(4096);
+        cout << "  single push/pop:   ";
+        measure([&] {
+            for (uint64_t i = 0; i < MESSAGES; ++i) {
+                while (!ring.tryPush(i)) this_thread::yield();
+            }
+        }, [&] {
+            uint64_t sum = 0, value;
+            for (uint64_t i = 0; i < MESSAGES; ++i) {
+                while (!ring.tryPop(value)) this_thread::yield();
+                sum += value;
+            }
+            return sum;
+        });
+    }
+    {
+        SPSCRingBuffer<uint64_t> ring(4096);
+        cout << "  batches of " << BATCH << ":    ";
+        measure([&] {
+            uint64_t chunk[BATCH];
+            for (uint64_t next = 0; next < MESSAGES;) {
+                size_t n = min<uint64_t>(BATCH, MESSAGES - next);
+                for (size_t i = 0; i < n; ++i) chunk[i] = next + i;
+                size_t sent = 0;
+                while (sent < n) {
+                    size_t pushed = ring.pushBatch(chunk + sent, n - sent);
+                    if (!pushed) this_thread::yield();
+                    sent += pushed;
+                }
+                next += n;
+            }
+        }, [&] {
+            uint64_t sum = 0, chunk[BATCH];
+            for (uint64_t received = 0; received < MESSAGES;) {
+                size_t n = ring.popBatch(chunk, BATCH);
+                if (!n) this_thread::yield();
+                for (size_t i = 0; i < n; ++i) sum += chunk[i];
+                received += n;
+            }
+            return sum;
+        });
+    }
+    {
+        SPSCRingBuffer<uint64_t> ring(4096);
+        cout << "  reserve/commit:    ";
+        measure([&] {
+            for (uint64_t next = 0; next < MESSAGES;) {
+                auto span = ring.reserve(min<uint64_t>(BATCH, MESSAGES - next));
+                if (!span.count) {
+                    this_thread::yield();
+                    continue;
+                }
+                for (size_t i = 0; i < span.count; ++i) span.data[i] = next + i;
+                ring.commit(span.count);
+                next += span.count;
+            }
+        }, [&] {
+            uint64_t sum = 0;
+            for (uint64_t received = 0; received < MESSAGES;) {
+                auto span = ring.peek();
+                if (!span.count) {
+                    this_thread::yield();
+                    continue;
+                }
+                for (size_t i = 0; i < span.count; ++i) sum += span.data[i];
+                ring.release(span.count);
+                received += span.count;
+            }
+            return sum;
+        });
+    }
+    {
+        MPMCBoundedQueue<uint64_t> queue(4096);
+        cout << "  MPMCBoundedQueue:  ";
+        measure([&] {
+            for (uint64_t i = 0; i < MESSAGES; ++i) {
+                while (!queue.tryPush(i)) this_thread::yield();
+            }
+        }, [&] {
+            uint64_t sum = 0, value;
+            for (uint64_t i = 0; i < MESSAGES; ++i) {
+                while (!queue.tryPop(value)) this_thread::yield();
+                sum += value;
+            }
+            return sum;
+        });
+    }
+    cout << defaultfloat << setprecision(6) << endl;
+}
+
 /*
  * ========================================================================
  * TESTING AND DEMONSTRATION
@@ -998,6 +2106,118 @@ void test_round_robin_scheduler() {
     cout << endl;
 }
 
+void test_concurrent_round_robin_scheduler() {
+    cout << "=== CONCURRENT ROUND ROBIN SCHEDULER TEST ===" << endl;
+    
+    const int PROCESSES = 20000;
+    vector<pair<int, int>> processes;
+    for (int i = 0; i < PROCESSES; ++i) processes.push_back({i, 1 + (i * 7919) % 40});
+    long long expected_quanta = 0;
+    for (auto& p : processes) expected_quanta += (p.second + 2) / 3;
+    
+    MPMCBoundedQueue<ScheduledProcess> bounded(256);
+    MichaelScottQueue<ScheduledProcess> linked;
+    ConcurrentRoundRobinScheduler<decltype(bounded)> on_bounded(bounded, 3);
+    ConcurrentRoundRobinScheduler<decltype(linked)> on_linked(linked, 3);
+    
+    cout << PROCESSES << " processes, quantum 3, 4 producers / 4 workers:" << endl;
+    auto a = on_bounded.run(processes, 4, 4);
+    cout << "  MPMCBoundedQueue:  " << a.completed << " completed, " << a.quanta << " quanta in "
+         << a.milliseconds << " ms" << (a.quanta == expected_quanta ? "" : "  MISMATCH") << endl;
+    auto b = on_linked.run(processes, 4, 4);
+    cout << "  MichaelScottQueue: " << b.completed << " completed, " << b.quanta << " quanta in "
+         << b.milliseconds << " ms" << (b.quanta == expected_quanta ? "" : "  MISMATCH") << endl;
+    
+    // Thread churn: short-lived threads exit while others may still protect
+    // their retired nodes; later scans adopt those orphans
+    MichaelScottQueue<int> churned;
+    size_t peak_orphans = 0;
+    for (int wave = 0; wave < 50; ++wave) {
+        vector<thread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([&churned] {
+                int value;
+                for (int i = 0; i < 2000; ++i) {
+                    churned.tryPush(i);
+                    churned.tryPop(value);
+                }
+            });
+        }
+        for (auto& t : threads) t.join();
+        peak_orphans = max(peak_orphans, HazardPointers::instance().orphanCount());
+    }
+    cout << "  Thread churn (50 waves x 4 threads): peak orphaned nodes " << peak_orphans
+         << " (hazard slots: " << HazardPointers::MAX_THREADS * HazardPointers::PER_THREAD << ")" << endl;
+    cout << endl;
+    
+    benchmarkConcurrentQueues();
+}
+
+void test_spsc_ring_buffer() {
+    cout << "=== SPSC RING BUFFER TEST ===" << endl;
+    
+    SPSCRingBuffer<int> ring(8);
+    int values[] = {1, 2, 3, 4, 5, 6};
+    cout << "Pushed batch of 6: " << ring.pushBatch(values, 6) << ", size " << ring.size() << endl;
+    
+    int out[4];
+    size_t popped = ring.popBatch(out, 4);
+    cout << "Popped " << popped << ": ";
+    for (size_t i = 0; i < popped; ++i) cout << out[i] << " ";
+    cout << endl;
+    
+    // Writer fills slots in place; the span stops at the physical end of the array
+    auto span = ring.reserve(8);
+    for (size_t i = 0; i < span.count; ++i) span.data[i] = 100 + static_cast<int>(i);
+    ring.commit(span.count);
+    cout << "Reserved and committed " << span.count << " slots in place, size " << ring.size() << endl;
+    
+    int value;
+    cout << "Drain: ";
+    while (ring.tryPop(value)) cout << value << " ";
+    cout << endl << endl;
+    
+    benchmarkSPSCRingBuffer();
+}
+
+void test_arena_circular_lists() {
+    cout << "=== ARENA CIRCULAR LISTS TEST ===" << endl;
+    
+    ArenaCircularSinglyLinkedList<int> ring;
+    for (int i = 1; i <= 5; ++i) ring.push_back(i);
+    ring.push_front(0);
+    ring.display();
+    ring.rotate(2);
+    cout << "After rotating by 2: ";
+    ring.display();
+    ring.pop_front();
+    ring.pop_back();
+    cout << "After pop_front and pop_back: ";
+    ring.display();
+    cout << "Contains 4: " << (ring.contains(4) ? "Yes" : "No") << endl;
+    
+    // Two rings sharing one arena; clear() recycles a whole ring in O(1)
+    ArenaCircularDoublyLinkedList<int>::Arena shared;
+    ArenaCircularDoublyLinkedList<int> first(shared), second(shared);
+    for (int i = 0; i < 4; ++i) {
+        first.push_back(i);
+        second.push_front(10 + i);
+    }
+    first.rotate(-1);
+    first.display_forward();
+    second.display_forward();
+    cout << "Live nodes in shared arena: " << shared.live_nodes() << endl;
+    first.clear();
+    cout << "After clearing the first ring: " << shared.live_nodes() << endl;
+    for (int i = 0; i < 4; ++i) second.push_back(20 + i);
+    cout << "Second ring reused the freed slots: " << shared.live_nodes() << " live, "
+         << shared.bytes_reserved() << " bytes reserved" << endl;
+    second.display_forward();
+    
+    benchmarkArenaCircularLists();
+    cout << endl;
+}
+
 /*
  * ========================================================================
  * MAIN FUNCTION
@@ -1011,6 +2231,9 @@ int main() {
     test_circular_doubly_linked_list();
     test_josephus_problem();
     test_round_robin_scheduler();
+    test_concurrent_round_robin_scheduler();
+    test_spsc_ring_buffer();
+    test_arena_circular_lists();
     
     cout << "=== All Circular Linked List Tests Completed! ===" << endl;
     
@@ -1052,6 +2275,16 @@ int main() {
  * 
  * SPACE COMPLEXITY: O(n) where n is number of elements
  * 
+ * CONCURRENT QUEUES:
+ * - MPMCBoundedQueue: O(1) push/pop, one CAS each, no allocation
+ * - MichaelScottQueue: O(1) push/pop amortized, lock-free, unbounded
+ * - Hazard pointer scan: O(R log H) per batch of R retired nodes
+ * - SPSCRingBuffer: wait-free O(1) push/pop, O(k) batch of k
+ * 
+ * ARENA CIRCULAR LISTS:
+ * - Arena circular singly/doubly: same bounds as above, clear() O(1)
+ * - Nodes of 8 (singly) or 12 (doubly) bytes for int, no per-node heap header
+ * 
  * KEY IMPLEMENTATION NOTES:
  * - Always maintain circularity in operations
  * - Handle single-node case specially
@@ -16,6 +16,9 @@
  * 6. LRU Cache implementation using doubly linked list
  * 7. Deque implementation
  * 8. Memory management and optimization
+ * 9. Intrusive lists and zero-allocation LRU cache
+ * 10. Persistent list and deque with O(1) snapshots
+ * 11. Arena-backed list with 32-bit node handles
  * 
  * LEARNING OBJECTIVES:
  * - Master doubly linked list fundamentals
@@ -32,9 +35,23 @@
 
 #include <iostream>
 #include <vector>
+#include <deque>
 #include <unordered_map>
 #include <algorithm>
 #include <stdexcept>
+#include <cstdlib>
+#include <cstdint>
+#include <new>
+#include <chrono>
+#include <random>
+#include <iomanip>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <memory>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
 
 using namespace std;
 
@@ -382,42 +399,48 @@ public:
     
     // Merge two sorted doubly linked lists - O(n+m) time, O(1) space
     static DLLNode* mergeSorted(DLLNode* l1, DLLNode* l2) {
-        if (!l1) return l2;
-        if (!l2) return l1;
-        
-        DLLNode* result = nullptr;
-        
-        if (l1->val <= l2->val) {
-            result = l1;
-            result->next = mergeSorted(l1->next, l2);
-            if (result->next) result->next->prev = result;
-        } else {
-            result = l2;
-            result->next = mergeSorted(l1, l2->next);
-            if (result->next) result->next->prev = result;
+        DLLNode* head = mergeNext(l1, l2);
+        DLLNode* prev = nullptr;
+        for (DLLNode* node = head; node; node = node->next) {
+            node->prev = prev;
+            prev = node;
         }
-        
-        return result;
+        return head;
     }
     
-    // Sort doubly linked list - Merge Sort O(n log n) time, O(log n) space
+    /*
+     * Sort doubly linked list - Bottom-up merge sort O(n log n) time, O(1) space
+     * 
+     * Merges only the next pointers, keeping pending runs in a binary-counter
+     * array (as in the Linux kernel's list_sort), so there is no recursion and
+     * no middle-finding walk. Prev pointers are rebuilt in one final pass.
+     */
     static DLLNode* sortList(DLLNode* head) {
-        if (!head || !head->next) return head;
-        
-        // Find middle and split
-        DLLNode* mid = findMiddle(head);
-        DLLNode* right = mid->next;
+        DLLNode* pending[64] = {};
+        int maxSlot = 0;
         
-        // Break the link
-        mid->next = nullptr;
-        if (right) right->prev = nullptr;
-        
-        // Recursively sort both halves
-        DLLNode* left = sortList(head);
-        right = sortList(right);
+        while (head) {
+            // Cut the next non-decreasing run
+            DLLNode* run = head;
+            while (head->next && !(head->next->val < head->val)) head = head->next;
+            DLLNode* rest = head->next;
+            head->next = nullptr;
+            head = rest;
+            
+            int slot = 0;
+            while (pending[slot]) {
+                run = mergeNext(pending[slot], run);
+                pending[slot++] = nullptr;
+            }
+            pending[slot] = run;
+            maxSlot = max(maxSlot, slot + 1);
+        }
         
-        // Merge sorted halves
-        return mergeSorted(left, right);
+        DLLNode* result = nullptr;
+        for (int slot = 0; slot < maxSlot; slot++) {
+            if (pending[slot]) result = mergeNext(pending[slot], result);
+        }
+        return mergeSorted(result, nullptr);
     }
     
     // Convert binary tree to doubly linked list - In-order traversal
@@ -514,6 +537,25 @@ private:
         inorderTraversal(root->next, head, prev);
     }
     
+    // Stable merge along next pointers only; prev pointers are left stale
+    static DLLNode* mergeNext(DLLNode* a, DLLNode* b) {
+        DLLNode* head = nullptr;
+        DLLNode** tail = &head;
+        while (a && b) {
+            if (b->val < a->val) {
+                *tail = b;
+                tail = &b->next;
+                b = b->next;
+            } else {
+                *tail = a;
+                tail = &a->next;
+                a = a->next;
+            }
+        }
+        *tail = a ? a : b;
+        return head;
+    }
+    
     // Helper function to get tail
     static DLLNode* getTail(DLLNode* head) {
         while (head && head->next) {
@@ -562,6 +604,9 @@ private:
  * - O(1) insertion and deletion at both ends
  * - O(1) removal of any node (when pointer is available)
  * - Easy to move nodes to front/back
+ * 
+ * This is the textbook node-per-entry version. It stays as written so
+ * benchmarkLRUCaches can measure IntrusiveLRUCache (section 6) against it.
  */
 
 class LRUCache {
@@ -788,7 +833,971 @@ public:
 };
 
 // ========================================================================
-// 7. DEMONSTRATION AND TESTING
+// 7. INTRUSIVE LISTS AND ZERO-ALLOCATION LRU CACHE
+// ========================================================================
+
+/*
+ * THEORY: Intrusive Linked Lists
+ * 
+ * DoublyLinkedList and LRUCache allocate a separate node for every element
+ * (and unordered_map allocates another one per key). An intrusive list
+ * instead stores the prev/next pointers inside the user's object:
+ * - Linking and unlinking never allocate; the object lives wherever the
+ *   owner put it (an array, a pool, the stack).
+ * - Given an object, removal is O(1) with no search and no map lookup.
+ * - One object can sit in several lists at once by inheriting one hook
+ *   per list, each distinguished by a tag type.
+ * 
+ * The list itself is a circular sentinel hook, so insert/erase never
+ * branch on empty or end cases.
+ * 
+ * IntrusiveLRUCache combines the hook with a preallocated entry array and
+ * an open-addressing key index (linear probing, backward-shift deletion,
+ * no tombstones): after construction, get/put perform zero allocations.
+ */
+
+// Counts global allocations so the benchmark can report allocations per operation
+static atomic<size_t> allocationCount{0};
+
+void* operator new(size_t size) {
+    allocationCount.fetch_add(1, memory_order_relaxed);
+    if (void* p = malloc(size)) return p;
+    throw bad_alloc();
+}
+
+// The nothrow form (used by std::get_temporary_buffer) must pair with the same free
+void* operator new(size_t size, const nothrow_t&) noexcept {
+    allocationCount.fetch_add(1, memory_order_relaxed);
+    return malloc(size);
+}
+
+// Out of line, or GCC inlines the free() into callers and warns that it
+// does not match their new (-Wmismatched-new-delete)
+__attribute__((noinline)) void operator delete(void* p) noexcept { free(p); }
+__attribute__((noinline)) void operator delete(void* p, size_t) noexcept { free(p); }
+
+template<typename Tag = void>
+struct ListHook {
+    ListHook* prev = nullptr;
+    ListHook* next = nullptr;
+    
+    // Link state belongs to the object's position, not its value: a copy
+    // starts unlinked and assignment keeps the target's own links, so
+    // copying an element never makes two hooks claim the same neighbours
+    ListHook() = default;
+    ListHook(const ListHook&) {}
+    ListHook& operator=(const ListHook&) { return *this; }
+    
+    bool isLinked() const { return next != nullptr; }
+    
+    // O(1) removal from whatever list holds this hook
+    void unlink() {
+        prev->next = next;
+        next->prev = prev;
+        prev = next = nullptr;
+    }
+};
+
+template<typename T, typename Tag = void>
+class IntrusiveList {
+private:
+    using Hook = ListHook<Tag>;
+    Hook sentinel;
+    size_t count = 0;
+    
+    static Hook* hookOf(T& item) { return static_cast<Hook*>(&item); }
+    static T* ownerOf(Hook* hook) { return static_cast<T*>(hook); }
+    
+    void linkBefore(Hook* position, Hook* hook) {
+        hook->prev = position->prev;
+        hook->next = position;
+        position->prev->next = hook;
+        position->prev = hook;
+        count++;
+    }
+    
+public:
+    IntrusiveList() {
+        sentinel.prev = sentinel.next = &sentinel;
+    }
+    
+    // Unlinks every element; the elements themselves are not owned
+    ~IntrusiveList() {
+        clear();
+    }
+    
+    IntrusiveList(const IntrusiveList&) = delete;
+    IntrusiveList& operator=(const IntrusiveList&) = delete;
+    
+    bool empty() const { return sentinel.next == &sentinel; }
+    size_t size() const { return count; }
+    
+    void pushFront(T& item) { linkBefore(sentinel.next, hookOf(item)); }
+    void pushBack(T& item) { linkBefore(&sentinel, hookOf(item)); }
+    
+    T* front() { return empty() ? nullptr : ownerOf(sentinel.next); }
+    T* back() { return empty() ? nullptr : ownerOf(sentinel.prev); }
+    
+    void erase(T& item) {
+        hookOf(item)->unlink();
+        count--;
+    }
+    
+    T* popFront() {
+        T* item = front();
+        if (item) erase(*item);
+        return item;
+    }
+    
+    T* popBack() {
+        T* item = back();
+        if (item) erase(*item);
+        return item;
+    }
+    
+    void moveToFront(T& item) {
+        erase(item);
+        pushFront(item);
+    }
+    
+    void clear() {
+        while (!empty()) popFront();
+    }
+    
+    template<typename Fn>
+    void forEach(Fn fn) {
+        for (Hook* h = sentinel.next; h != &sentinel; h = h->next) fn(*ownerOf(h));
+    }
+};
+
+// Fixed-capacity int -> Value map with linear probing and backward-shift deletion
+template<typename Value>
+class OpenAddressingIndex {
+private:
+    struct Slot {
+        int key;
+        bool used;
+        Value value;
+    };
+    
+    vector<Slot> slots;
+    size_t mask;
+    
+    size_t home(int key) const {
+        uint64_t h = static_cast<uint32_t>(key) * 0x9E3779B97F4A7C15ULL;
+        return static_cast<size_t>(h >> 32) & mask;
+    }
+    
+public:
+    // Sized for at most maxKeys live keys at load factor <= 0.5
+    explicit OpenAddressingIndex(size_t maxKeys) {
+        size_t capacity = 16;
+        while (capacity < maxKeys * 2) capacity <<= 1;
+        slots.assign(capacity, Slot{0, false, Value()});
+        mask = capacity - 1;
+    }
+    
+    Value* find(int key) {
+        for (size_t i = home(key);; i = (i + 1) & mask) {
+            if (!slots[i].used) return nullptr;
+            if (slots[i].key == key) return &slots[i].value;
+        }
+    }
+    
+    void insert(int key, Value value) {
+        size_t i = home(key);
+        while (slots[i].used && slots[i].key != key) i = (i + 1) & mask;
+        slots[i] = Slot{key, true, value};
+    }
+    
+    void erase(int key) {
+        size_t i = home(key);
+        while (slots[i].used && slots[i].key != key) i = (i + 1) & mask;
+        if (!slots[i].used) return;
+        // Shift later members of the probe run back so lookups never hit a hole
+        for (size_t j = (i + 1) & mask; slots[j].used; j = (j + 1) & mask) {
+            size_t h = home(slots[j].key);
+            bool movable = (i <= j) ? (h <= i || h > j) : (h <= i && h > j);
+            if (movable) {
+                slots[i] = slots[j];
+                i = j;
+            }
+        }
+        slots[i].used = false;
+    }
+};
+
+struct LRUTag {};
+
+class IntrusiveLRUCache {
+private:
+    struct Entry : ListHook<LRUTag> {
+        int key = 0;
+        int value = 0;
+    };
+    
+    vector<Entry> entries;     // Preallocated; entries never move
+    size_t used = 0;
+    IntrusiveList<Entry, LRUTag> recency;  // Most recent at the front
+    OpenAddressingIndex<Entry*> index;
+    
+    // Checked before the members are sized: with no entries, put() would
+    // have nothing to evict into
+    static int checkedCapacity(int capacity) {
+        if (capacity <= 0) throw invalid_argument("LRU capacity must be positive");
+        return capacity;
+    }
+    
+public:
+    IntrusiveLRUCache(int capacity) : entries(checkedCapacity(capacity)), index(capacity) {}
+    
+    int get(int key) {
+        Entry** entry = index.find(key);
+        if (!entry) return -1;
+        recency.moveToFront(**entry);
+        return (*entry)->value;
+    }
+    
+    void put(int key, int value) {
+        if (Entry** found = index.find(key)) {
+            (*found)->value = value;
+            recency.moveToFront(**found);
+            return;
+        }
+        Entry* entry;
+        if (used < entries.size()) {
+            entry = &entries[used++];
+        } else {
+            // Reuse the least recently used entry in place
+            entry = recency.popBack();
+            index.erase(entry->key);
+        }
+        entry->key = key;
+        entry->value = value;
+        recency.pushFront(*entry);
+        index.insert(key, entry);
+    }
+    
+    size_t size() const { return recency.size(); }
+    
+    void display() {
+        cout << "Intrusive LRU Cache (most recent -> least recent): ";
+        recency.forEach([](Entry& e) { cout << "(" << e.key << "," << e.value << ") "; });
+        cout << endl;
+    }
+};
+
+void benchmarkLRUCaches() {
+    cout << "\n=== LRU CACHE BENCHMARK ===" << endl;
+    const int CAPACITY = 4096;
+    const int OPS = 1 << 20;
+    
+    mt19937 gen(7);
+    vector<pair<int, int>> ops(OPS);  // (key, 0 = get / 1 = put)
+    for (auto& op : ops) op = {static_cast<int>(gen() % (CAPACITY * 2)), static_cast<int>(gen() % 2)};
+    
+    auto run = [&](auto& cache, const char* name) {
+        size_t allocationsBefore = allocationCount;
+        long long checksum = 0;
+        auto start = chrono::steady_clock::now();
+        for (auto [key, isPut] : ops) {
+            if (isPut) cache.put(key, key * 3);
+            else checksum += cache.get(key);
+        }
+        double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        double perOp = static_cast<double>(allocationCount - allocationsBefore) / OPS;
+        cout << "  " << left << setw(20) << name << right << fixed << setprecision(2) << setw(8) << ms << " ms, "
+             << setprecision(3) << perOp << " allocations/op" << defaultfloat << setprecision(6) << endl;
+        return checksum;
+    };
+    
+    cout << OPS << " mixed get/put on " << CAPACITY * 2 << " keys, capacity " << CAPACITY << ":" << endl;
+    LRUCache classic(CAPACITY);
+    IntrusiveLRUCache intrusive(CAPACITY);
+    long long a = run(classic, "LRUCache");
+    long long b = run(intrusive, "IntrusiveLRUCache");
+    if (a != b) cout << "  MISMATCH" << endl;
+}
+
+// ========================================================================
+// 8. PERSISTENT LIST AND DEQUE (O(1) SNAPSHOTS)
+// ========================================================================
+
+/*
+ * THEORY: Persistent Data Structures with Structural Sharing
+ * 
+ * DoublyLinkedList and Deque mutate nodes in place, so a reader that needs
+ * a consistent view has to copy all n elements. A persistent structure
+ * never changes a node after creating it:
+ * - PersistentList is an immutable singly linked (cons) list. pushFront
+ *   allocates one node pointing at the old head, so the old version is
+ *   still intact and both versions share every existing node.
+ * - Nodes are reference counted (atomically, so versions can be released
+ *   on any thread); a node is freed when no version reaches it.
+ * - Copying a list or deque handle is O(1): it bumps one or two counts.
+ *   That copy IS the snapshot.
+ * 
+ * PersistentDeque is Okasaki's banker's deque: a front list and a rear
+ * list (stored reversed). Pushes and pops touch only list heads. When one
+ * side grows beyond 3x the other (or runs empty) both are rebuilt around
+ * the middle, O(n) work that happens at most every n/2 operations, so
+ * operations are O(1) amortized. (Replaying operations on one old version
+ * again and again can repeat a rebuild; the amortized bound assumes each
+ * version is extended once, which is the snapshot-reader pattern.)
+ * 
+ * VersionedDeque publishes the current version to concurrent readers: a
+ * mutex guards only O(1) handle copies and swaps. Writers build the next
+ * version outside it (a rebuild included) and publish only if no other
+ * writer got in first, else retry; replaced versions are also released
+ * outside it. Readers iterate their own snapshot without any lock.
+ */
+
+template<typename T>
+class PersistentList {
+private:
+    struct Node {
+        T value;
+        Node* next;
+        atomic<uint32_t> refs;
+        
+        Node(const T& v, Node* n) : value(v), next(n), refs(1) {}
+    };
+    
+    Node* head = nullptr;
+    size_t length = 0;
+    
+    static Node* retain(Node* node) {
+        if (node) node->refs.fetch_add(1, memory_order_relaxed);
+        return node;
+    }
+    
+    // Iterative so releasing a long unshared chain cannot overflow the stack
+    static void release(Node* node) {
+        while (node && node->refs.fetch_sub(1, memory_order_acq_rel) == 1) {
+            Node* next = node->next;
+            delete node;
+            node = next;
+        }
+    }
+    
+    PersistentList(Node* h, size_t len) : head(h), length(len) {}
+    
+public:
+    PersistentList() = default;
+    
+    // O(1) snapshot: shares every node
+    PersistentList(const PersistentList& other) : head(retain(other.head)), length(other.length) {}
+    
+    PersistentList(PersistentList&& other) noexcept : head(other.head), length(other.length) {
+        other.head = nullptr;
+        other.length = 0;
+    }
+    
+    PersistentList& operator=(PersistentList other) {
+        swap(head, other.head);
+        swap(length, other.length);
+        return *this;
+    }
+    
+    ~PersistentList() {
+        release(head);
+    }
+    
+    bool empty() const { return head == nullptr; }
+    size_t size() const { return length; }
+    
+    const T& front() const {
+        if (!head) throw runtime_error("List is empty");
+        return head->value;
+    }
+    
+    // New version with val in front - O(1), this version unchanged
+    PersistentList pushFront(const T& val) const {
+        return PersistentList(new Node(val, retain(head)), length + 1);
+    }
+    
+    // New version without the front element - O(1)
+    PersistentList popFront() const {
+        if (!head) throw runtime_error("List is empty");
+        return PersistentList(retain(head->next), length - 1);
+    }
+    
+    // Builds a list whose front is values[first] - O(last - first)
+    static PersistentList fromRange(const T* first, const T* last) {
+        PersistentList result;
+        while (last != first) result = result.pushFront(*--last);
+        return result;
+    }
+    
+    template<typename Fn>
+    void forEach(Fn fn) const {
+        for (const Node* node = head; node; node = node->next) fn(node->value);
+    }
+    
+    vector<T> toVector() const {
+        vector<T> result;
+        result.reserve(length);
+        forEach([&](const T& v) { result.push_back(v); });
+        return result;
+    }
+    
+    // True if both versions start at the same node (shared structure)
+    bool sharesHeadWith(const PersistentList& other) const {
+        return head == other.head;
+    }
+};
+
+template<typename T>
+class PersistentDeque {
+private:
+    static const size_t BALANCE = 3;
+    
+    PersistentList<T> frontList;  // Front element first
+    PersistentList<T> rearList;   // Back element first
+    
+    PersistentDeque(PersistentList<T> f, PersistentList<T> r) : frontList(move(f)), rearList(move(r)) {}
+    
+    // Shared by every forEach instantiation on this thread
+    static vector<const T*>& rearStack() {
+        static thread_local vector<const T*> stack;
+        return stack;
+    }
+    
+    // Splits all elements evenly between the two lists - O(n)
+    static PersistentDeque rebalance(const PersistentList<T>& f, const PersistentList<T>& r) {
+        size_t n = f.size() + r.size();
+        if (n < 2 || (f.size() <= BALANCE * r.size() + 1 && r.size() <= BALANCE * f.size() + 1)) {
+            return PersistentDeque(f, r);
+        }
+        vector<T> all = f.toVector();
+        vector<T> back = r.toVector();
+        all.insert(all.end(), back.rbegin(), back.rend());
+        
+        size_t half = n / 2;
+        vector<T> reversedBack(all.rbegin(), all.rend() - half);
+        return PersistentDeque(PersistentList<T>::fromRange(all.data(), all.data() + half),
+                               PersistentList<T>::fromRange(reversedBack.data(), reversedBack.data() + reversedBack.size()));
+    }
+    
+public:
+    PersistentDeque() = default;
+    
+    bool empty() const { return frontList.empty() && rearList.empty(); }
+    size_t size() const { return frontList.size() + rearList.size(); }
+    
+    // O(1) amortized; every operation returns a new version
+    PersistentDeque pushFront(const T& val) const { return rebalance(frontList.pushFront(val), rearList); }
+    PersistentDeque pushBack(const T& val) const { return rebalance(frontList, rearList.pushFront(val)); }
+    
+    PersistentDeque popFront() const {
+        if (empty()) throw runtime_error("Deque is empty");
+        if (frontList.empty()) return PersistentDeque();  // Single element in the rear
+        return rebalance(frontList.popFront(), rearList);
+    }
+    
+    PersistentDeque popBack() const {
+        if (empty()) throw runtime_error("Deque is empty");
+        if (rearList.empty()) return PersistentDeque();  // Single element in the front
+        return rebalance(frontList, rearList.popFront());
+    }
+    
+    const T& front() const {
+        if (empty()) throw runtime_error("Deque is empty");
+        return frontList.empty() ? rearList.front() : frontList.front();
+    }
+    
+    const T& back() const {
+        if (empty()) throw runtime_error("Deque is empty");
+        return rearList.empty() ? frontList.front() : rearList.front();
+    }
+    
+    // The rear is stored back-first, so it is walked through a per-thread
+    // stack of element pointers: no copies, and no allocation once the
+    // stack has grown. Indexing from base keeps nested calls (fn iterating
+    // another deque) safe even if the stack reallocates.
+    template<typename Fn>
+    void forEach(Fn fn) const {
+        frontList.forEach(fn);
+        vector<const T*>& stack = rearStack();
+        struct Truncate {
+            vector<const T*>& stack;
+            size_t base;
+            ~Truncate() { stack.resize(base); }  // Also if fn throws
+        } frame{stack, stack.size()};
+        rearList.forEach([&](const T& v) { stack.push_back(&v); });
+        for (size_t i = stack.size(); i-- > frame.base; ) fn(*stack[i]);
+    }
+    
+    vector<T> toVector() const {
+        vector<T> result;
+        result.reserve(size());
+        forEach([&](const T& v) { result.push_back(v); });
+        return result;
+    }
+    
+    void display() const {
+        cout << "Persistent deque: ";
+        forEach([](const T& v) { cout << v << " "; });
+        cout << "(size " << size() << ")" << endl;
+    }
+};
+
+// Latest version shared between writer threads and snapshotting readers
+template<typename T>
+class VersionedDeque {
+private:
+    PersistentDeque<T> current;
+    uint64_t version = 0;  // Bumped on every publish
+    mutable mutex lock;
+    
+public:
+    // O(1): copies the handle, never the elements
+    PersistentDeque<T> snapshot() const {
+        lock_guard<mutex> guard(lock);
+        return current;
+    }
+    
+    // Applies fn to the latest version and publishes the result. fn runs
+    // without the lock and is called again if another writer published in
+    // the meantime, so it must not have side effects.
+    template<typename Fn>
+    void update(Fn fn) {
+        for (;;) {
+            PersistentDeque<T> base;
+            uint64_t seen;
+            {
+                lock_guard<mutex> guard(lock);
+                base = current;
+                seen = version;
+            }
+            PersistentDeque<T> next = fn(base);
+            {
+                lock_guard<mutex> guard(lock);
+                if (version == seen) {
+                    swap(current, next);  // next now holds the old version
+                    version++;
+                    return;  // The old version is released after the unlock
+                }
+            }
+        }
+    }
+};
+
+void benchmarkPersistentDeque() {
+    cout << "\n=== PERSISTENT DEQUE BENCHMARK ===" << endl;
+    
+    auto elapsedMs = [](chrono::steady_clock::time_point start) {
+        return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    };
+    
+    cout << "Snapshot cost (average per snapshot):" << endl;
+    cout << fixed << setprecision(3);
+    for (int n : {1000, 100000, 1000000}) {
+        Deque mutableDeque;
+        PersistentDeque<int> persistent;
+        for (int i = 0; i < n; i++) {
+            mutableDeque.pushBack(i);
+            persistent = persistent.pushBack(i);
+        }
+        
+        int copies = max(1, 2000000 / n);
+        size_t sink = 0;
+        auto start = chrono::steady_clock::now();
+        for (int i = 0; i < copies; i++) {
+            Deque copy = mutableDeque;
+            sink += copy.size();
+        }
+        double copyUs = elapsedMs(start) * 1000 / copies;
+        
+        start = chrono::steady_clock::now();
+        for (int i = 0; i < copies * 100; i++) {
+            PersistentDeque<int> snapshot = persistent;
+            sink += snapshot.size();
+        }
+        double snapshotUs = elapsedMs(start) * 1000 / (copies * 100);
+        
+        cout << "  n = " << setw(7) << n << ": Deque copy " << setw(12) << copyUs << " us, persistent snapshot "
+             << setw(8) << snapshotUs << " us" << (sink ? "" : " ") << endl;
+    }
+    
+    // Readers sum whole snapshots while writers push and pop
+    const int N = 100000;
+    const int DURATION_MS = 300;
+    cout << "Readers summing " << N << "-element snapshots during writes (" << DURATION_MS << " ms):" << endl;
+    for (int writers : {1, 2}) {
+        for (int readers : {1, 4}) {
+            Deque lockedDeque;
+            mutex dequeLock;
+            VersionedDeque<int> versioned;
+            for (int i = 0; i < N; i++) lockedDeque.pushBack(i);
+            versioned.update([&](const PersistentDeque<int>&) {
+                PersistentDeque<int> d;
+                for (int i = 0; i < N; i++) d = d.pushBack(i);
+                return d;
+            });
+            
+            auto run = [&](auto writeOnce, auto readOnce) {
+                atomic<bool> stop{false};
+                atomic<long long> reads{0}, writes{0};
+                vector<thread> threads;
+                for (int w = 0; w < writers; w++) {
+                    threads.emplace_back([&] {
+                        while (!stop.load(memory_order_relaxed)) {
+                            writeOnce();
+                            writes.fetch_add(1, memory_order_relaxed);
+                        }
+                    });
+                }
+                for (int r = 0; r < readers; r++) {
+                    threads.emplace_back([&] {
+                        while (!stop.load(memory_order_relaxed)) {
+                            if (readOnce() < 0) cout << "unreachable" << endl;
+                            reads.fetch_add(1, memory_order_relaxed);
+                        }
+                    });
+                }
+                this_thread::sleep_for(chrono::milliseconds(DURATION_MS));
+                stop = true;
+                for (auto& t : threads) t.join();
+                return make_pair(reads.load() * 1000.0 / DURATION_MS, writes.load() * 1000.0 / DURATION_MS);
+            };
+            
+            // Baseline: copy the mutable deque under the lock, then read the copy
+            auto locked = run(
+                [&] {
+                    lock_guard<mutex> guard(dequeLock);
+                    lockedDeque.pushBack(1);
+                    lockedDeque.popFront();
+                },
+                [&] {
+                    Deque copy;
+                    {
+                        lock_guard<mutex> guard(dequeLock);
+                        copy = lockedDeque;
+                    }
+                    long long sum = 0;
+                    while (!copy.empty()) {
+                        sum += copy.front();
+                        copy.popFront();
+                    }
+                    return sum;
+                });
+            
+            auto persistent = run(
+                [&] { versioned.update([](const PersistentDeque<int>& d) { return d.pushBack(1).popFront(); }); },
+                [&] {
+                    long long sum = 0;
+                    versioned.snapshot().forEach([&](int v) { sum += v; });
+                    return sum;
+                });
+            
+            cout << setprecision(0) << "  " << writers << "W/" << readers << "R: Deque copy " << setw(7) << locked.first
+                 << " reads/s, " << setw(9) << locked.second << " writes/s | persistent " << setw(7) << persistent.first
+                 << " reads/s, " << setw(9) << persistent.second << " writes/s" << endl;
+        }
+    }
+    cout << defaultfloat << setprecision(6);
+}
+
+// ========================================================================
+// 9. ARENA-BACKED DOUBLY LINKED LIST WITH 32-BIT HANDLES
+// ========================================================================
+
+/*
+ * THEORY: Handle-Based Doubly Linked List
+ * 
+ * A DLLNode is 24 bytes, and with the heap header it occupies 32 bytes.
+ * Every insert calls new and clear() deletes the nodes one by one. Storing
+ * nodes in a HandleArena (one vector, addressed by uint32_t index) gives:
+ * - 12-byte nodes (int + prev/next handles), packed in insertion order
+ * - O(1) allocate/release through a free list threaded through next
+ * - O(1) clear: the list hands its whole head..tail chain to the free
+ *   list
+ * - Handles that survive the vector growing (pointers would not)
+ * 
+ * Several lists may share one arena and still clear independently.
+ */
+
+template<typename Node>
+class HandleArena {
+private:
+    vector<Node> nodes;
+    uint32_t freeHead;
+    size_t live = 0;
+    
+public:
+    static constexpr uint32_t NIL = UINT32_MAX;
+    
+    HandleArena() : freeHead(NIL) {}
+    
+    uint32_t allocate() {
+        if (freeHead != NIL) {
+            uint32_t handle = freeHead;
+            freeHead = nodes[handle].next;
+            live++;
+            return handle;
+        }
+        if (nodes.size() >= NIL) throw length_error("Arena is out of handles");
+        nodes.emplace_back();  // Counted only once it succeeded
+        live++;
+        return static_cast<uint32_t>(nodes.size() - 1);
+    }
+    
+    void release(uint32_t handle) {
+        nodes[handle].next = freeHead;
+        freeHead = handle;
+        live--;
+    }
+    
+    // Returns a chain first..last of count nodes linked through next - O(1)
+    void releaseChain(uint32_t first, uint32_t last, size_t count) {
+        nodes[last].next = freeHead;
+        freeHead = first;
+        live -= count;
+    }
+    
+    Node& operator[](uint32_t handle) { return nodes[handle]; }
+    const Node& operator[](uint32_t handle) const { return nodes[handle]; }
+    
+    size_t liveNodes() const { return live; }
+    size_t bytesReserved() const { return nodes.capacity() * sizeof(Node); }
+};
+
+struct ArenaDLLNode {
+    int val;
+    uint32_t prev;
+    uint32_t next;
+};
+
+class ArenaDoublyLinkedList {
+public:
+    using Arena = HandleArena<ArenaDLLNode>;
+    static constexpr uint32_t NIL = Arena::NIL;
+    
+private:
+    unique_ptr<Arena> ownedArena;
+    Arena* arena;
+    uint32_t head = NIL;
+    uint32_t tail = NIL;
+    int size = 0;
+    
+    ArenaDLLNode& at(uint32_t handle) const { return (*arena)[handle]; }
+    
+    uint32_t newNode(int val, uint32_t prev, uint32_t next) {
+        uint32_t handle = arena->allocate();
+        at(handle) = ArenaDLLNode{val, prev, next};
+        return handle;
+    }
+    
+    uint32_t handleAt(int pos) const {
+        uint32_t h;
+        if (pos < size / 2) {
+            h = head;
+            for (int i = 0; i < pos; i++) h = at(h).next;
+        } else {
+            h = tail;
+            for (int i = size - 1; i > pos; i--) h = at(h).prev;
+        }
+        return h;
+    }
+    
+    void unlink(uint32_t h) {
+        ArenaDLLNode& node = at(h);
+        if (node.prev != NIL) at(node.prev).next = node.next; else head = node.next;
+        if (node.next != NIL) at(node.next).prev = node.prev; else tail = node.prev;
+        arena->release(h);
+        size--;
+    }
+    
+public:
+    ArenaDoublyLinkedList() : ownedArena(new Arena), arena(ownedArena.get()) {}
+    explicit ArenaDoublyLinkedList(Arena& shared) : arena(&shared) {}
+    
+    ~ArenaDoublyLinkedList() {
+        clear();
+    }
+    
+    ArenaDoublyLinkedList(const ArenaDoublyLinkedList&) = delete;
+    ArenaDoublyLinkedList& operator=(const ArenaDoublyLinkedList&) = delete;
+    
+    // Insert at head - O(1)
+    void insertHead(int val) {
+        uint32_t h = newNode(val, NIL, head);
+        if (head != NIL) at(head).prev = h; else tail = h;
+        head = h;
+        size++;
+    }
+    
+    // Insert at tail - O(1)
+    void insertTail(int val) {
+        uint32_t h = newNode(val, tail, NIL);
+        if (tail != NIL) at(tail).next = h; else head = h;
+        tail = h;
+        size++;
+    }
+    
+    // Insert at position - O(n), walking from the nearer end
+    void insertAt(int pos, int val) {
+        if (pos < 0 || pos > size) throw out_of_range("Position out of bounds");
+        if (pos == 0) return insertHead(val);
+        if (pos == size) return insertTail(val);
+        
+        uint32_t next = handleAt(pos);
+        uint32_t prev = at(next).prev;
+        uint32_t h = newNode(val, prev, next);
+        at(prev).next = h;
+        at(next).prev = h;
+        size++;
+    }
+    
+    // Delete head - O(1)
+    bool deleteHead() {
+        if (head == NIL) return false;
+        unlink(head);
+        return true;
+    }
+    
+    // Delete tail - O(1)
+    bool deleteTail() {
+        if (tail == NIL) return false;
+        unlink(tail);
+        return true;
+    }
+    
+    // Delete at position - O(n)
+    bool deleteAt(int pos) {
+        if (pos < 0 || pos >= size) return false;
+        unlink(handleAt(pos));
+        return true;
+    }
+    
+    // Delete first occurrence of val - O(n)
+    bool deleteByValue(int val) {
+        for (uint32_t h = head; h != NIL; h = at(h).next) {
+            if (at(h).val == val) {
+                unlink(h);
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    bool search(int val) const {
+        for (uint32_t h = head; h != NIL; h = at(h).next) {
+            if (at(h).val == val) return true;
+        }
+        return false;
+    }
+    
+    int get(int pos) const {
+        if (pos < 0 || pos >= size) throw out_of_range("Position out of bounds");
+        return at(handleAt(pos)).val;
+    }
+    
+    int getSize() const { return size; }
+    bool isEmpty() const { return head == NIL; }
+    
+    // Clear all nodes - O(1)
+    void clear() {
+        if (head != NIL) arena->releaseChain(head, tail, size);
+        head = tail = NIL;
+        size = 0;
+    }
+    
+    void displayForward() const {
+        cout << "Forward: ";
+        for (uint32_t h = head; h != NIL; h = at(h).next) {
+            cout << at(h).val;
+            if (at(h).next != NIL) cout << " <-> ";
+        }
+        cout << " <-> null" << endl;
+    }
+    
+    void displayBackward() const {
+        cout << "Backward: ";
+        for (uint32_t h = tail; h != NIL; h = at(h).prev) {
+            cout << at(h).val;
+            if (at(h).prev != NIL) cout << " <-> ";
+        }
+        cout << " <-> null" << endl;
+    }
+    
+    vector<int> toVector() const {
+        vector<int> result;
+        result.reserve(size);
+        for (uint32_t h = head; h != NIL; h = at(h).next) result.push_back(at(h).val);
+        return result;
+    }
+    
+    const Arena& getArena() const { return *arena; }
+};
+
+// Bytes currently allocated from the heap, where the C library can report it
+size_t heapBytesInUse() {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    return mallinfo2().uordblks;
+#else
+    return 0;
+#endif
+}
+
+void benchmarkArenaDoublyList() {
+    cout << "\n=== ARENA DOUBLY LINKED LIST BENCHMARK ===" << endl;
+    const int N = 2000000;
+    
+    auto timeIt = [](auto&& fn) {
+        auto start = chrono::steady_clock::now();
+        fn();
+        return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    };
+    
+    struct Row { double bytes, allocations, insert, scan, clear; long long check; };
+    auto measure = [&](auto& list) {
+        Row row;
+        size_t heapBefore = heapBytesInUse();
+        size_t allocationsBefore = allocationCount;
+        row.insert = timeIt([&] {
+            for (int i = 0; i < N; i++) {
+                if (i % 2) list.insertTail(i); else list.insertHead(i);
+            }
+        });
+        row.allocations = static_cast<double>(allocationCount - allocationsBefore) / N;
+        row.bytes = static_cast<double>(heapBytesInUse() - heapBefore) / N;
+        row.scan = timeIt([&] { row.check = list.search(-1) + list.getSize(); });
+        row.clear = timeIt([&] { list.clear(); });
+        return row;
+    };
+    
+    Row rows[3];
+    {
+        DoublyLinkedList list;
+        rows[0] = measure(list);
+    }
+    {
+        ArenaDoublyLinkedList list;
+        rows[1] = measure(list);
+        rows[2] = measure(list);  // Refill from the free list
+        // Node storage is the arena's vector, counted once for both runs
+        rows[1].bytes = rows[2].bytes = static_cast<double>(list.getArena().bytesReserved()) / N;
+    }
+    
+    const char* names[3] = {"DoublyLinkedList", "Arena list (fresh)", "Arena list (reuse)"};
+    cout << N << " alternating insertHead/insertTail, search miss, clear:" << endl;
+    cout << left << setw(22) << "" << right << setw(12) << "bytes/node" << setw(10) << "allocs/op"
+         << setw(12) << "insert ms" << setw(10) << "scan ms" << setw(11) << "clear ms" << endl;
+    cout << fixed;
+    for (int i = 0; i < 3; i++) {
+        cout << left << setw(22) << names[i] << right << setprecision(1) << setw(12) << rows[i].bytes
+             << setprecision(3) << setw(10) << rows[i].allocations << setprecision(1) << setw(12) << rows[i].insert
+             << setw(10) << rows[i].scan << setprecision(3) << setw(11) << rows[i].clear << endl;
+    }
+    cout << defaultfloat << setprecision(6);
+    cout << "Results agree: " << (rows[0].check == rows[1].check && rows[1].check == rows[2].check ? "Yes" : "No")
+         << endl;
+}
+
+// ========================================================================
+// 10. DEMONSTRATION AND TESTING
 // ========================================================================
 
 void demonstrateBasicOperations() {
@@ -816,6 +1825,32 @@ void demonstrateBasicOperations() {
     cout << "Size: " << dll.getSize() << endl;
 }
 
+// Seeded check of sortList against std::stable_sort: node order must
+// match (so it is stable) and every prev pointer must mirror next
+bool checkSortList(unsigned seed, int cases) {
+    mt19937 gen(seed);
+    for (int c = 0; c < cases; ++c) {
+        size_t n = gen() % 300;
+        vector<DLLNode> nodes(n);
+        for (size_t i = 0; i < n; ++i) {
+            nodes[i].val = static_cast<int>(gen() % 10);
+            nodes[i].next = i + 1 < n ? &nodes[i + 1] : nullptr;
+            nodes[i].prev = i > 0 ? &nodes[i - 1] : nullptr;
+        }
+        vector<size_t> order(n);
+        for (size_t i = 0; i < n; ++i) order[i] = i;
+        stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return nodes[a].val < nodes[b].val; });
+        
+        DLLNode* node = DoublyLinkedListAlgorithms::sortList(n ? &nodes[0] : nullptr);
+        DLLNode* prev = nullptr;
+        for (size_t i = 0; i < n; ++i, prev = node, node = node->next) {
+            if (node != &nodes[order[i]] || node->prev != prev) return false;
+        }
+        if (node) return false;
+    }
+    return true;
+}
+
 void demonstrateAdvancedAlgorithms() {
     cout << "\n=== ADVANCED DOUBLY LINKED LIST ALGORITHMS ===" << endl;
     
@@ -837,6 +1872,8 @@ void demonstrateAdvancedAlgorithms() {
     head = DoublyLinkedListAlgorithms::sortList(head);
     cout << "After sorting: ";
     DoublyLinkedListUtils::printList(head);
+    cout << "sortList vs std::stable_sort, prev links included (300 seeded cases): "
+         << (checkSortList(95, 300) ? "matches" : "MISMATCH") << endl;
     
     // Clean up
     DoublyLinkedListUtils::deleteList(head);
@@ -863,6 +1900,66 @@ void demonstrateLRUCache() {
     cache.display();
 }
 
+void demonstrateIntrusiveList() {
+    cout << "\n=== INTRUSIVE LIST DEMONSTRATION ===" << endl;
+    
+    // One task object linked into two lists at once, no list nodes allocated
+    struct ReadyTag {};
+    struct AllTag {};
+    struct Task : ListHook<ReadyTag>, ListHook<AllTag> {
+        int id;
+        Task(int i) : id(i) {}
+    };
+    
+    vector<Task> tasks = {1, 2, 3, 4};
+    IntrusiveList<Task, AllTag> all;
+    IntrusiveList<Task, ReadyTag> ready;
+    for (Task& t : tasks) all.pushBack(t);
+    ready.pushBack(tasks[2]);
+    ready.pushBack(tasks[0]);
+    
+    auto show = [](const char* name, auto& list) {
+        cout << name << ": ";
+        list.forEach([](Task& t) { cout << t.id << " "; });
+        cout << endl;
+    };
+    show("All tasks", all);
+    show("Ready", ready);
+    
+    ready.erase(tasks[2]);  // O(1), the task knows its own position
+    all.moveToFront(tasks[3]);
+    show("Ready after finishing 3", ready);
+    show("All after touching 4", all);
+    
+    // Copies carry the id but not the links; assigning into a linked task
+    // leaves it where it was
+    Task copy = tasks[0];
+    tasks[1] = copy;
+    bool copiesUnlinked = !static_cast<ListHook<AllTag>&>(copy).isLinked() &&
+                          !static_cast<ListHook<ReadyTag>&>(copy).isLinked();
+    bool linksKept = static_cast<ListHook<AllTag>&>(tasks[1]).isLinked() &&
+                     !static_cast<ListHook<ReadyTag>&>(tasks[1]).isLinked() && all.size() == 4;
+    cout << "Copy unlinked: " << (copiesUnlinked ? "Yes" : "No")
+         << ", assigned task keeps its links: " << (linksKept ? "Yes" : "No") << endl;
+    show("All after copying 1 over 2", all);
+    
+    IntrusiveLRUCache cache(3);
+    cache.put(1, 10);
+    cache.put(2, 20);
+    cache.put(3, 30);
+    cout << "Get key 2: " << cache.get(2) << endl;
+    cache.put(4, 40);  // Evicts key 1, reusing its entry
+    cache.display();
+    cout << "Get key 1: " << cache.get(1) << endl;
+    try {
+        IntrusiveLRUCache empty(0);
+    } catch (const invalid_argument& e) {
+        cout << "Capacity 0: " << e.what() << endl;
+    }
+    
+    benchmarkLRUCaches();
+}
+
 void demonstrateDeque() {
     cout << "\n=== DEQUE DEMONSTRATION ===" << endl;
     
@@ -891,6 +1988,104 @@ void demonstrateDeque() {
 // MAIN FUNCTION - COMPREHENSIVE DEMONSTRATION
 // ========================================================================
 
+void demonstratePersistentDeque() {
+    cout << "\n=== PERSISTENT LIST AND DEQUE ===" << endl;
+    
+    PersistentList<int> base = PersistentList<int>().pushFront(3).pushFront(2).pushFront(1);
+    PersistentList<int> withZero = base.pushFront(0);
+    PersistentList<int> tail = base.popFront();
+    cout << "base: ";
+    base.forEach([](int v) { cout << v << " "; });
+    cout << "| base.pushFront(0): ";
+    withZero.forEach([](int v) { cout << v << " "; });
+    cout << "| base.popFront(): ";
+    tail.forEach([](int v) { cout << v << " "; });
+    cout << endl;
+    cout << "pushFront(0).popFront() shares base's nodes: "
+         << (withZero.popFront().sharesHeadWith(base) ? "Yes" : "No") << endl;
+    
+    PersistentDeque<int> v1;
+    for (int i = 1; i <= 5; i++) v1 = v1.pushBack(i * 10);
+    PersistentDeque<int> snapshot = v1;  // O(1)
+    PersistentDeque<int> v2 = v1.pushFront(5).popBack().popBack();
+    cout << "Snapshot -> ";
+    snapshot.display();
+    cout << "After pushFront(5), popBack() x2 -> ";
+    v2.display();
+    cout << "Front: " << v2.front() << ", Back: " << v2.back() << endl;
+    
+    // Random pushes and pops at both ends against std::deque; every read
+    // also nests a forEach of the previous version, as a reader might
+    mt19937 gen(19);
+    deque<int> expected;
+    PersistentDeque<int> current, previous;
+    bool same = true;
+    for (int op = 0; op < 20000 && same; op++) {
+        previous = current;
+        int choice = static_cast<int>(gen() % 4);
+        if (choice < 2 || expected.empty()) {
+            int v = static_cast<int>(gen() % 1000);
+            if (gen() % 2) { current = current.pushFront(v); expected.push_front(v); }
+            else { current = current.pushBack(v); expected.push_back(v); }
+        } else if (choice == 2) {
+            current = current.popFront();
+            expected.pop_front();
+        } else {
+            current = current.popBack();
+            expected.pop_back();
+        }
+        size_t i = 0, nested = 0;
+        current.forEach([&](int v) {
+            same = same && i < expected.size() && v == expected[i++];
+            if (i == 1) previous.forEach([&](int) { nested++; });
+        });
+        same = same && i == expected.size() && (expected.empty() || nested == previous.size());
+    }
+    long long sum = 0;
+    current.forEach([&](int v) { sum += v; });  // Grows this thread's rear stack once
+    size_t allocationsBefore = allocationCount;
+    for (int r = 0; r < 100; r++) current.forEach([&](int v) { sum += v; });
+    cout << "20000 random operations match std::deque: " << (same ? "Yes" : "No")
+         << ", allocations in 100 more forEach reads: " << (allocationCount - allocationsBefore) << endl;
+    
+    // Writers build outside the lock and retry on a lost race; no update
+    // may be dropped
+    VersionedDeque<int> shared;
+    vector<thread> writers;
+    for (int w = 0; w < 4; w++) {
+        writers.emplace_back([&shared, w] {
+            for (int i = 0; i < 2000; i++) shared.update([&](const PersistentDeque<int>& d) { return d.pushBack(w); });
+        });
+    }
+    for (auto& writer : writers) writer.join();
+    cout << "4 writers x 2000 concurrent updates kept: " << shared.snapshot().size() << endl;
+    
+    benchmarkPersistentDeque();
+}
+
+void demonstrateArenaDoublyList() {
+    cout << "\n=== ARENA-BACKED DOUBLY LINKED LIST ===" << endl;
+    
+    ArenaDoublyLinkedList::Arena shared;
+    ArenaDoublyLinkedList a(shared), b(shared);
+    for (int i = 1; i <= 5; i++) {
+        a.insertTail(i);
+        b.insertHead(i * 10);
+    }
+    a.insertAt(2, 99);
+    a.deleteTail();
+    a.deleteByValue(1);
+    a.displayForward();
+    a.displayBackward();
+    b.displayForward();
+    cout << "a.get(1) = " << a.get(1) << ", live nodes in shared arena: " << shared.liveNodes() << endl;
+    
+    b.clear();  // O(1)
+    cout << "After b.clear(): " << shared.liveNodes() << " live nodes" << endl;
+    
+    benchmarkArenaDoublyList();
+}
+
 int main() {
     cout << "DOUBLY LINKED LIST - COMPREHENSIVE IMPLEMENTATION" << endl;
     cout << "================================================" << endl;
@@ -900,6 +2095,9 @@ int main() {
         demonstrateAdvancedAlgorithms();
         demonstrateLRUCache();
         demonstrateDeque();
+        demonstrateIntrusiveList();
+        demonstratePersistentDeque();
+        demonstrateArenaDoublyList();
         
         cout << "\n=== SUMMARY ===" << endl;
         cout << "✓ Basic operations with O(1) head/tail operations" << endl;
@@ -908,6 +2106,9 @@ int main() {
         cout << "✓ LRU Cache implementation" << endl;
         cout << "✓ Deque implementation" << endl;
         cout << "✓ Efficient memory management" << endl;
+        cout << "✓ Intrusive lists and zero-allocation LRU cache" << endl;
+        cout << "✓ Persistent list and deque with O(1) snapshots" << endl;
+        cout << "✓ Arena-backed list with 32-bit handles and O(1) clear" << endl;
         
     } catch (const exception& e) {
         cerr << "Error: " << e.what() << endl;
@@ -920,7 +2121,7 @@ int main() {
 /*
  * COMPILATION AND EXECUTION:
  * 
- * To compile: g++ -std=c++17 -O2 -o doubly_linked_list doubly_linked_list.cpp
+ * To compile: g++ -std=c++17 -O2 -pthread -o doubly_linked_list doubly_linked_list.cpp
  * To run: ./doubly_linked_list
  * 
  * TIME COMPLEXITY COMPARISON:
@@ -935,6 +2136,12 @@ int main() {
  * Search              | O(n)      | O(n)
  * Reverse             | O(n)      | O(n)
  * 
+ * INTRUSIVE LIST: O(1) link/unlink of a known object, zero allocations
+ * INTRUSIVE LRU: O(1) expected get/put, zero allocations after construction
+ * PERSISTENT LIST: O(1) pushFront/popFront/snapshot, nodes shared between versions
+ * PERSISTENT DEQUE: O(1) amortized push/pop at both ends, O(1) snapshot
+ * ARENA LIST: O(1) head/tail insert and delete, O(1) clear, 12 bytes per node
+ * 
  * SPACE COMPLEXITY:
  * - Each node: 12 bytes (4 for data + 8 for two pointers on 64-bit)
  * - vs Singly LL: 8 bytes (4 for data + 4 for one pointer on 64-bit)
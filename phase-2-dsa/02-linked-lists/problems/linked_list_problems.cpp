@@ -28,6 +28,8 @@
 #include <queue>
 #include <algorithm>
 #include <climits>
+#include <string>
+#include <random>
 
 using namespace std;
 
@@ -621,8 +623,8 @@ public:
      * Time: O(m + n), Space: O(1)
      */
     static ListNode* mergeTwoLists(ListNode* l1, ListNode* l2) {
-        ListNode* dummy = new ListNode(0);
-        ListNode* current = dummy;
+        ListNode dummy(0);
+        ListNode* current = &dummy;
         
         while (l1 && l2) {
             if (l1->val <= l2->val) {
@@ -638,9 +640,7 @@ public:
         // Attach remaining nodes
         current->next = l1 ? l1 : l2;
         
-        ListNode* result = dummy->next;
-        delete dummy;
-        return result;
+        return dummy.next;
     }
     
     /*
@@ -657,20 +657,54 @@ public:
     
     /*
      * Problem 18: Sort List
-     * Sort a linked list in O(n log n) time.
+     * Sort a linked list in O(n log n) time, O(1) extra space.
      * 
-     * Approach: Merge sort
-     * Time: O(n log n), Space: O(log n)
+     * Approach: Bottom-up merge sort over natural runs. Each run is cut off
+     * (a strictly descending one is reversed, a short one is extended to
+     * MIN_RUN nodes by insertion) and pushed into a binary counter of
+     * pending runs (slot i holds ~2^i runs); an occupied slot is merged and
+     * carried upward. No recursion and no middle-finding walks. Stable.
+     * Time: O(n log r) for r runs, Space: O(1)
      */
+    static constexpr int MIN_RUN = 16;
+    
     static ListNode* sortList(ListNode* head) {
+        ListNode* pending[64] = {};
+        int maxSlot = 0;
+        
+        while (head) {
+            ListNode* run = takeRun(head);
+            int slot = 0;
+            while (pending[slot]) {
+                run = mergeTwoLists(pending[slot], run);
+                pending[slot++] = nullptr;
+            }
+            pending[slot] = run;
+            maxSlot = max(maxSlot, slot + 1);
+        }
+        
+        ListNode* result = nullptr;
+        for (int slot = 0; slot < maxSlot; slot++) {
+            if (pending[slot]) result = mergeTwoLists(pending[slot], result);
+        }
+        return result;
+    }
+    
+    /*
+     * Problem 18 (Classic): top-down merge sort
+     * 
+     * Approach: Split at the middle, sort halves recursively, merge
+     * Time: O(n log n), Space: O(log n) recursion
+     */
+    static ListNode* sortListTopDown(ListNode* head) {
         if (!head || !head->next) return head;
         
         // Find middle and split
         ListNode* mid = findMiddleAndSplit(head);
         
         // Recursively sort both halves
-        ListNode* left = sortList(head);
-        ListNode* right = sortList(mid);
+        ListNode* left = sortListTopDown(head);
+        ListNode* right = sortListTopDown(mid);
         
         // Merge sorted halves
         return mergeTwoLists(left, right);
@@ -680,20 +714,22 @@ public:
      * Problem 19: Insertion Sort List
      * Sort using insertion sort algorithm.
      * 
-     * Approach: Build sorted portion iteratively
-     * Time: O(n²), Space: O(1)
+     * Approach: Build sorted portion iteratively, resuming the scan from the
+     * last insertion point when the next value is not smaller
+     * Time: O(n²) worst, O(n) for sorted or nearly sorted input, Space: O(1)
      */
     static ListNode* insertionSortList(ListNode* head) {
         if (!head || !head->next) return head;
         
-        ListNode* dummy = new ListNode(0);
+        ListNode dummy(0);
+        ListNode* lastInserted = &dummy;
         ListNode* current = head;
         
         while (current) {
             ListNode* next = current->next;
             
             // Find insertion position
-            ListNode* prev = dummy;
+            ListNode* prev = lastInserted->val <= current->val ? lastInserted : &dummy;
             while (prev->next && prev->next->val < current->val) {
                 prev = prev->next;
             }
@@ -701,13 +737,12 @@ public:
             // Insert current node
             current->next = prev->next;
             prev->next = current;
+            lastInserted = current;
             
             current = next;
         }
         
-        ListNode* result = dummy->next;
-        delete dummy;
-        return result;
+        return dummy.next;
     }
     
     /*
@@ -745,6 +780,46 @@ public:
     }
 
 private:
+    // Detaches the next run from head, sorted and at least MIN_RUN long when possible
+    static ListNode* takeRun(ListNode*& head) {
+        ListNode* run = head;
+        ListNode* last = head;
+        int length = 1;
+        
+        if (last->next && last->next->val < last->val) {
+            // Strictly descending: reverse it as we go (strict keeps it stable)
+            ListNode* next = last->next;
+            last->next = nullptr;
+            while (next && next->val < run->val) {
+                ListNode* after = next->next;
+                next->next = run;
+                run = next;
+                next = after;
+                length++;
+            }
+            head = next;
+        } else {
+            while (last->next && last->next->val >= last->val) {
+                last = last->next;
+                length++;
+            }
+            head = last->next;
+            last->next = nullptr;
+        }
+        
+        // Extend short runs by linear insertion, after any equal values
+        while (length < MIN_RUN && head) {
+            ListNode* node = head;
+            head = head->next;
+            ListNode** link = &run;
+            while (*link && (*link)->val <= node->val) link = &(*link)->next;
+            node->next = *link;
+            *link = node;
+            length++;
+        }
+        return run;
+    }
+    
     static ListNode* mergeKListsHelper(vector<ListNode*>& lists, int start, int end) {
         if (start == end) return lists[start];
         if (start > end) return nullptr;
@@ -772,28 +847,6 @@ private:
         
         return slow;
     }
-    
-    static ListNode* mergeTwoLists(ListNode* l1, ListNode* l2) {
-        ListNode* dummy = new ListNode(0);
-        ListNode* current = dummy;
-        
-        while (l1 && l2) {
-            if (l1->val <= l2->val) {
-                current->next = l1;
-                l1 = l1->next;
-            } else {
-                current->next = l2;
-                l2 = l2->next;
-            }
-            current = current->next;
-        }
-        
-        current->next = l1 ? l1 : l2;
-        
-        ListNode* result = dummy->next;
-        delete dummy;
-        return result;
-    }
 };
 
 /*
@@ -858,6 +911,48 @@ public:
         return copyHead;
     }
     
+    /*
+     * Problem 21 follow-up: copy into one contiguous block
+     * The copies go into storage in list order, so the copy of the i-th node
+     * is storage[i]. Each original's next borrows the link to its copy (the
+     * copy keeps the original next), random pointers are then fixed by one
+     * sequential sweep of storage, and a last sweep restores the originals.
+     * No per-node new, no hash map; storage must not hold the source list.
+     * Time: O(n), Space: O(1) besides the copies
+     */
+    static RandomListNode* copyRandomListContiguous(RandomListNode* head, vector<RandomListNode>& storage) {
+        size_t n = 0;
+        for (RandomListNode* node = head; node; node = node->next) n++;
+        storage.clear();
+        storage.reserve(n);  // no reallocation below, so pointers into storage stay valid
+        
+        // Phase 1: copy in list order; original->next points to its copy for now
+        for (RandomListNode* node = head; node; ) {
+            storage.emplace_back(node->val);
+            RandomListNode& copy = storage.back();
+            copy.next = node->next;
+            copy.random = node->random;
+            node->next = &copy;
+            node = copy.next;
+        }
+        
+        // Phase 2: the copy of an original is its borrowed next
+        for (RandomListNode& copy : storage) {
+            if (copy.random) copy.random = copy.random->next;
+        }
+        
+        // Phase 3: give the originals their next back and chain the copies
+        RandomListNode* original = head;
+        for (size_t i = 0; i < n; ++i) {
+            RandomListNode* nextOriginal = storage[i].next;
+            original->next = nextOriginal;
+            storage[i].next = i + 1 < n ? &storage[i + 1] : nullptr;
+            original = nextOriginal;
+        }
+        
+        return n ? &storage[0] : nullptr;
+    }
+    
     /*
      * Problem 22: LRU Cache Implementation
      * Implement LRU cache using doubly linked list + hash map.
@@ -1100,6 +1195,41 @@ private:
  * ========================================================================
  */
 
+// Seeded check of both sortList variants against std::stable_sort: the
+// node order (not just the values) must match, so stability is checked
+// too. Inputs mix random, ascending and descending stretches with ties.
+bool checkSortList(unsigned seed, int cases) {
+    mt19937 gen(seed);
+    for (int c = 0; c < cases; ++c) {
+        size_t n = gen() % 300;
+        vector<int> values(n);
+        int pattern = static_cast<int>(gen() % 3);
+        for (size_t i = 0; i < n; ++i) {
+            int noise = static_cast<int>(gen() % 4);
+            values[i] = pattern == 0 ? static_cast<int>(gen() % 10)
+                      : pattern == 1 ? static_cast<int>(i / 3) + noise
+                                     : static_cast<int>((n - i) / 3) + noise;
+        }
+        vector<size_t> order(n);
+        for (size_t i = 0; i < n; ++i) order[i] = i;
+        stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return values[a] < values[b]; });
+        
+        for (auto sort : {MergeSortOperations::sortList, MergeSortOperations::sortListTopDown}) {
+            vector<ListNode> nodes(n);
+            for (size_t i = 0; i < n; ++i) {
+                nodes[i].val = values[i];
+                nodes[i].next = i + 1 < n ? &nodes[i + 1] : nullptr;
+            }
+            ListNode* node = sort(n ? &nodes[0] : nullptr);
+            for (size_t i = 0; i < n; ++i, node = node->next) {
+                if (node != &nodes[order[i]]) return false;
+            }
+            if (node) return false;
+        }
+    }
+    return true;
+}
+
 void testBasicOperations() {
     cout << "=== BASIC OPERATIONS TESTS ===" << endl;
     
@@ -1222,6 +1352,16 @@ void testMergeSortOperations() {
     list3 = MergeSortOperations::sortList(list3);
     LinkedListUtils::printList(list3, "Sorted");
     
+    ListNode* list5 = LinkedListUtils::createList({5, 6, 7, 1, 2, 9, 8, 3});
+    list5 = MergeSortOperations::sortListTopDown(list5);
+    LinkedListUtils::printList(list5, "Sorted top-down");
+    cout << "sortList / sortListTopDown vs std::stable_sort (300 seeded cases): "
+         << (checkSortList(95, 300) ? "matches" : "MISMATCH") << endl;
+    
+    ListNode* list6 = LinkedListUtils::createList({1, 2, 4, 3, 5, 6});
+    list6 = MergeSortOperations::insertionSortList(list6);
+    LinkedListUtils::printList(list6, "Insertion sorted");
+    
     // Test Partition
     cout << "\nPartition List:" << endl;
     ListNode* list4 = LinkedListUtils::createList({1, 4, 3, 2, 5, 2});
@@ -1234,6 +1374,8 @@ void testMergeSortOperations() {
     LinkedListUtils::deleteList(merged);
     LinkedListUtils::deleteList(list3);
     LinkedListUtils::deleteList(list4);
+    LinkedListUtils::deleteList(list5);
+    LinkedListUtils::deleteList(list6);
     
     cout << endl;
 }
@@ -1257,6 +1399,36 @@ void testAdvancedAlgorithms() {
     cout << "get(3): " << cache.get(3) << endl;  // returns 3
     cout << "get(4): " << cache.get(4) << endl;  // returns 4
     
+    // Test Copy List with Random Pointer: 7 -> 13 -> 11 -> 10 -> 1
+    cout << "\nCopy Random List:" << endl;
+    using RandomListNode = AdvancedAlgorithms::RandomListNode;
+    vector<RandomListNode*> originals;
+    for (int v : {7, 13, 11, 10, 1}) originals.push_back(new RandomListNode(v));
+    int randomIndex[] = {-1, 0, 4, 2, 0};
+    for (size_t i = 0; i < originals.size(); ++i) {
+        if (i + 1 < originals.size()) originals[i]->next = originals[i + 1];
+        if (randomIndex[i] >= 0) originals[i]->random = originals[randomIndex[i]];
+    }
+    auto printRandomList = [](RandomListNode* head, const string& name) {
+        cout << name << ": ";
+        for (RandomListNode* node = head; node; node = node->next) {
+            cout << "[" << node->val << ", " << (node->random ? to_string(node->random->val) : "null") << "] ";
+        }
+        cout << endl;
+    };
+    RandomListNode* woven = AdvancedAlgorithms::copyRandomList(originals[0]);
+    printRandomList(woven, "Interweave copy ");
+    vector<RandomListNode> storage;
+    RandomListNode* contiguous = AdvancedAlgorithms::copyRandomListContiguous(originals[0], storage);
+    printRandomList(contiguous, "Contiguous copy ");
+    printRandomList(originals[0], "Original after  ");
+    while (woven) {
+        RandomListNode* next = woven->next;
+        delete woven;
+        woven = next;
+    }
+    for (RandomListNode* node : originals) delete node;
+    
     // Test Add Two Numbers
     cout << "\nAdd Two Numbers:" << endl;
     ListNode* num1 = LinkedListUtils::createList({2, 4, 3});  // represents 342
@@ -1339,7 +1511,7 @@ int main() {
  * 20. Partition: O(n) time, O(1) space
  * 
  * ADVANCED ALGORITHMS:
- * 21. Copy Random List: O(n) time, O(1) space
+ * 21. Copy Random List: O(n) time, O(1) space (contiguous copy: no per-node new)
  * 22. LRU Cache: O(1) get/put, O(capacity) space
  * 23. Flatten Multilevel: O(n) time, O(d) space
  * 24. Add Two Numbers: O(max(m,n)) time, O(max(m,n)) space
@@ -15,6 +15,9 @@
  * 6. Cycle detection and removal
  * 7. Merging and sorting
  * 8. Advanced operations
+ * 9. Unrolled linked lists (cache-friendly blocks)
+ * 10. Parallel list ranking and prefix sums
+ * 11. Arena-backed list with 32-bit node handles
  * 
  * LEARNING OBJECTIVES:
  * - Master linked list fundamentals
@@ -33,6 +36,19 @@
 #include <unordered_set>
 #include <stack>
 #include <algorithm>
+#include <stdexcept>
+#include <deque>
+#include <chrono>
+#include <random>
+#include <iomanip>
+#include <cstdint>
+#include <atomic>
+#include <thread>
+#include <functional>
+#include <memory>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
 
 using namespace std;
 
@@ -328,6 +344,151 @@ public:
  * - Cycle detection and handling
  */
 
+/*
+ * THEORY: Cache-Friendly List Sorting
+ * 
+ * Top-down merge sort walks half the list at every level just to find the
+ * middle, and recursion costs O(log n) stack. The bottom-up form (the Linux
+ * kernel's list_sort) visits the input once, front to back:
+ * - Cut the list into natural runs: an ascending run is taken as-is, a
+ *   strictly descending run is reversed (keeping stability), and short runs
+ *   are extended to MIN_RUN nodes by insertion.
+ * - Push each run into an array of pending runs indexed like a binary
+ *   counter: slot i holds about 2^i runs' worth of nodes, and pushing into
+ *   an occupied slot merges and carries upward. Recently produced runs are
+ *   merged while still in cache.
+ * - Finally merge the slots from smallest to largest.
+ * O(n log r) time for r runs, O(1) extra space, no recursion.
+ * 
+ * For very long lists whose nodes are scattered in memory, every merge pass
+ * still chases cold pointers. sortByGather instead copies (value, index)
+ * keys into a contiguous buffer, radix sorts them with sequential streaming
+ * passes, then relinks the nodes in one pass. O(n) time, O(n) extra space.
+ */
+
+class ListSort {
+public:
+    static constexpr int MIN_RUN = 16;
+    
+    // Stable merge of two sorted lists without a dummy node
+    static ListNode* mergeRuns(ListNode* a, ListNode* b) {
+        ListNode* head = nullptr;
+        ListNode** tail = &head;
+        while (a && b) {
+            if (b->val < a->val) {
+                *tail = b;
+                tail = &b->next;
+                b = b->next;
+            } else {
+                *tail = a;
+                tail = &a->next;
+                a = a->next;
+            }
+        }
+        *tail = a ? a : b;
+        return head;
+    }
+    
+    // Bottom-up merge sort over natural runs - O(n log r) time, O(1) space
+    static ListNode* sortBottomUp(ListNode* head) {
+        ListNode* pending[64] = {};
+        int maxSlot = 0;
+        
+        while (head) {
+            ListNode* run = takeRun(head);
+            int slot = 0;
+            while (pending[slot]) {
+                run = mergeRuns(pending[slot], run);
+                pending[slot++] = nullptr;
+            }
+            pending[slot] = run;
+            maxSlot = max(maxSlot, slot + 1);
+        }
+        
+        ListNode* result = nullptr;
+        for (int slot = 0; slot < maxSlot; slot++) {
+            if (pending[slot]) result = mergeRuns(pending[slot], result);
+        }
+        return result;
+    }
+    
+    // Gather keys, radix sort a contiguous buffer, relink - O(n) time, O(n) space
+    static ListNode* sortByGather(ListNode* head) {
+        vector<ListNode*> nodes;
+        for (ListNode* node = head; node; node = node->next) nodes.push_back(node);
+        size_t n = nodes.size();
+        if (n < 2) return head;
+        
+        // High half: value with the sign bit flipped so unsigned order matches;
+        // low half: original position, which keeps equal values stable
+        vector<uint64_t> keys(n), buffer(n);
+        for (size_t i = 0; i < n; i++) {
+            uint32_t biased = static_cast<uint32_t>(nodes[i]->val) ^ 0x80000000u;
+            keys[i] = (static_cast<uint64_t>(biased) << 32) | i;
+        }
+        
+        for (int shift = 32; shift < 64; shift += 8) {
+            size_t counts[256] = {};
+            for (uint64_t key : keys) counts[(key >> shift) & 0xFF]++;
+            if (counts[(keys[0] >> shift) & 0xFF] == n) continue;  // Byte is constant
+            size_t offset = 0;
+            for (size_t& c : counts) {
+                size_t count = c;
+                c = offset;
+                offset += count;
+            }
+            for (uint64_t key : keys) buffer[counts[(key >> shift) & 0xFF]++] = key;
+            keys.swap(buffer);
+        }
+        
+        for (size_t i = 0; i + 1 < n; i++) {
+            nodes[static_cast<uint32_t>(keys[i])]->next = nodes[static_cast<uint32_t>(keys[i + 1])];
+        }
+        nodes[static_cast<uint32_t>(keys[n - 1])]->next = nullptr;
+        return nodes[static_cast<uint32_t>(keys[0])];
+    }
+    
+    // Detaches the next run from head, sorted and at least MIN_RUN long when possible
+    static ListNode* takeRun(ListNode*& head) {
+        ListNode* run = head;
+        ListNode* last = head;
+        int length = 1;
+        
+        if (last->next && last->next->val < last->val) {
+            // Strictly descending: reverse it as we go
+            ListNode* next = last->next;
+            last->next = nullptr;
+            while (next && next->val < run->val) {
+                ListNode* after = next->next;
+                next->next = run;
+                run = next;
+                next = after;
+                length++;
+            }
+            head = next;
+        } else {
+            while (last->next && !(last->next->val < last->val)) {
+                last = last->next;
+                length++;
+            }
+            head = last->next;
+            last->next = nullptr;
+        }
+        
+        // Extend short runs by linear insertion of the following nodes
+        while (length < MIN_RUN && head) {
+            ListNode* node = head;
+            head = head->next;
+            ListNode** link = &run;
+            while (*link && !(node->val < (*link)->val)) link = &(*link)->next;
+            node->next = *link;
+            *link = node;
+            length++;
+        }
+        return run;
+    }
+};
+
 class LinkedListAlgorithms {
 public:
     // Reverse linked list - Iterative O(n) time, O(1) space
@@ -463,8 +624,13 @@ public:
         return dummy.next;
     }
     
-    // Sort linked list - Merge Sort O(n log n) time, O(log n) space
+    // Sort linked list - Bottom-up merge sort O(n log n) time, O(1) space
     static ListNode* sortList(ListNode* head) {
+        return ListSort::sortBottomUp(head);
+    }
+    
+    // Sort linked list - Top-down merge sort O(n log n) time, O(log n) space
+    static ListNode* sortListTopDown(ListNode* head) {
         if (!head || !head->next) return head;
         
         // Find middle and split
@@ -474,8 +640,8 @@ public:
         mid->next = nullptr;
         
         // Recursively sort both halves
-        left = sortList(left);
-        right = sortList(right);
+        left = sortListTopDown(left);
+        right = sortListTopDown(right);
         
         // Merge sorted halves
         return mergeSorted(left, right);
@@ -670,7 +836,1030 @@ public:
 };
 
 // ========================================================================
-// 5. DEMONSTRATION AND TESTING
+// 5. UNROLLED LINKED LIST (CACHE-FRIENDLY VARIANT)
+// ========================================================================
+
+/*
+ * THEORY: Unrolled Linked List
+ * 
+ * SinglyLinkedList spends 16 bytes (int + pointer + padding) and one
+ * heap allocation per element, and every hop in get/search/toVector is
+ * a dependent load that usually misses the cache.
+ * 
+ * An unrolled list stores a small array of elements in each node:
+ * - Each node is 256 bytes (4 cache lines, aligned): next pointer,
+ *   count and CAPACITY = 60 ints. Scans read whole cache lines, and
+ *   positional access hops once per node instead of once per element.
+ * - Every node except the last stays between 50% and 100% full:
+ *   a full node splits in half on insert, and an underfull node
+ *   borrows from or merges with its successor on delete.
+ * - Keeping a tail pointer makes insertTail O(1).
+ * 
+ * Trade-off: insert/delete shift up to CAPACITY elements within a node
+ * (one or two cache lines of memmove), which is cheap next to a miss.
+ */
+
+class UnrolledLinkedList {
+public:
+    static constexpr int CAPACITY = 60;
+    static constexpr int MIN_FILL = CAPACITY / 2;
+    
+private:
+    struct alignas(64) UnrolledNode {
+        UnrolledNode* next = nullptr;
+        int count = 0;
+        int values[CAPACITY];
+    };
+    static_assert(sizeof(UnrolledNode) == 256, "node should span exactly 4 cache lines");
+    
+    UnrolledNode* head;
+    UnrolledNode* tail;
+    int size;
+    int nodes;
+    
+    UnrolledNode* newNode() {
+        nodes++;
+        return new UnrolledNode();
+    }
+    
+    void deleteNode(UnrolledNode* node) {
+        nodes--;
+        delete node;
+    }
+    
+    // Moves the upper half of a full node into a new successor
+    void split(UnrolledNode* node) {
+        UnrolledNode* right = newNode();
+        int keep = node->count / 2;
+        right->count = node->count - keep;
+        copy(node->values + keep, node->values + node->count, right->values);
+        node->count = keep;
+        right->next = node->next;
+        node->next = right;
+        if (tail == node) tail = right;
+    }
+    
+    // Restores the fill invariant of a non-last node after a delete
+    void rebalance(UnrolledNode* prev, UnrolledNode* node) {
+        if (node->count == 0 && !node->next) {
+            if (prev) {
+                prev->next = nullptr;
+                tail = prev;
+                deleteNode(node);
+            }
+            return;
+        }
+        if (!node->next || node->count >= MIN_FILL) return;
+        
+        UnrolledNode* next = node->next;
+        if (node->count + next->count <= CAPACITY) {
+            // Merge the successor into this node
+            copy(next->values, next->values + next->count, node->values + node->count);
+            node->count += next->count;
+            node->next = next->next;
+            if (tail == next) tail = node;
+            deleteNode(next);
+        } else {
+            // Borrow from the successor up to half full; it keeps more than half
+            int borrow = MIN_FILL - node->count;
+            copy(next->values, next->values + borrow, node->values + node->count);
+            copy(next->values + borrow, next->values + next->count, next->values);
+            node->count += borrow;
+            next->count -= borrow;
+        }
+    }
+    
+    // Node holding position pos (and its predecessor); offset receives the index inside it
+    UnrolledNode* locate(int pos, int& offset, UnrolledNode** prev = nullptr) const {
+        UnrolledNode* before = nullptr;
+        UnrolledNode* current = head;
+        while (pos >= current->count && current->next) {
+            pos -= current->count;
+            before = current;
+            current = current->next;
+        }
+        offset = pos;
+        if (prev) *prev = before;
+        return current;
+    }
+    
+public:
+    UnrolledLinkedList() : head(nullptr), tail(nullptr), size(0), nodes(0) {}
+    
+    ~UnrolledLinkedList() {
+        clear();
+    }
+    
+    UnrolledLinkedList(const UnrolledLinkedList& other) : head(nullptr), tail(nullptr), size(0), nodes(0) {
+        for (UnrolledNode* node = other.head; node; node = node->next) {
+            for (int i = 0; i < node->count; i++) insertTail(node->values[i]);
+        }
+    }
+    
+    UnrolledLinkedList& operator=(const UnrolledLinkedList& other) {
+        if (this != &other) {
+            clear();
+            for (UnrolledNode* node = other.head; node; node = node->next) {
+                for (int i = 0; i < node->count; i++) insertTail(node->values[i]);
+            }
+        }
+        return *this;
+    }
+    
+    // Insert at head - O(CAPACITY)
+    void insertHead(int val) {
+        insertAt(0, val);
+    }
+    
+    // Insert at tail - O(1); the last node is the only one allowed below half full
+    void insertTail(int val) {
+        if (!tail) {
+            head = tail = newNode();
+        } else if (tail->count == CAPACITY) {
+            tail->next = newNode();
+            tail = tail->next;
+        }
+        tail->values[tail->count++] = val;
+        size++;
+    }
+    
+    // Insert at position - O(n / CAPACITY + CAPACITY)
+    void insertAt(int pos, int val) {
+        if (pos < 0 || pos > size) {
+            throw out_of_range("Position out of bounds");
+        }
+        if (pos == size) {
+            insertTail(val);
+            return;
+        }
+        
+        int offset;
+        UnrolledNode* node = locate(pos, offset);
+        if (node->count == CAPACITY) {
+            split(node);
+            if (offset > node->count) {
+                offset -= node->count;
+                node = node->next;
+            }
+        }
+        copy_backward(node->values + offset, node->values + node->count, node->values + node->count + 1);
+        node->values[offset] = val;
+        node->count++;
+        size++;
+    }
+    
+    // Delete head - O(CAPACITY)
+    bool deleteHead() {
+        return deleteAt(0);
+    }
+    
+    // Delete tail - O(n / CAPACITY), the predecessor of the tail node is needed
+    bool deleteTail() {
+        return deleteAt(size - 1);
+    }
+    
+    // Delete at position - O(n / CAPACITY + CAPACITY)
+    bool deleteAt(int pos) {
+        if (pos < 0 || pos >= size) return false;
+        
+        int offset;
+        UnrolledNode* prev;
+        UnrolledNode* node = locate(pos, offset, &prev);
+        copy(node->values + offset + 1, node->values + node->count, node->values + offset);
+        node->count--;
+        size--;
+        
+        if (size == 0) {
+            clear();
+        } else if (node->count == 0 && node == head) {
+            head = node->next;
+            deleteNode(node);
+        } else {
+            rebalance(prev, node);
+        }
+        return true;
+    }
+    
+    // Delete by value - O(n)
+    bool deleteByValue(int val) {
+        int pos = 0;
+        for (UnrolledNode* node = head; node; node = node->next) {
+            int* found = find(node->values, node->values + node->count, val);
+            if (found != node->values + node->count) {
+                return deleteAt(pos + static_cast<int>(found - node->values));
+            }
+            pos += node->count;
+        }
+        return false;
+    }
+    
+    // Search for value - O(n), one contiguous scan per node
+    bool search(int val) const {
+        for (UnrolledNode* node = head; node; node = node->next) {
+            if (find(node->values, node->values + node->count, val) != node->values + node->count) return true;
+        }
+        return false;
+    }
+    
+    // Get value at position - O(n / CAPACITY)
+    int get(int pos) const {
+        if (pos < 0 || pos >= size) {
+            throw out_of_range("Position out of bounds");
+        }
+        int offset;
+        UnrolledNode* node = locate(pos, offset);
+        return node->values[offset];
+    }
+    
+    int getSize() const { return size; }
+    
+    bool isEmpty() const { return size == 0; }
+    
+    int getNodeCount() const { return nodes; }
+    
+    // Fraction of allocated slots that hold elements
+    double fillRatio() const { return nodes ? static_cast<double>(size) / (nodes * CAPACITY) : 0.0; }
+    
+    void clear() {
+        while (head) {
+            UnrolledNode* temp = head;
+            head = head->next;
+            delete temp;
+        }
+        tail = nullptr;
+        size = 0;
+        nodes = 0;
+    }
+    
+    void display() const {
+        cout << "Unrolled list: ";
+        for (UnrolledNode* node = head; node; node = node->next) {
+            cout << "[";
+            for (int i = 0; i < node->count; i++) cout << node->values[i] << (i + 1 < node->count ? " " : "");
+            cout << "]" << (node->next ? " -> " : "");
+        }
+        cout << " -> null" << endl;
+    }
+    
+    vector<int> toVector() const {
+        vector<int> result;
+        result.reserve(size);
+        for (UnrolledNode* node = head; node; node = node->next) {
+            result.insert(result.end(), node->values, node->values + node->count);
+        }
+        return result;
+    }
+};
+
+void benchmarkUnrolledList() {
+    cout << "\n=== UNROLLED LIST BENCHMARK ===" << endl;
+    const int N = 200000;
+    const int OPS = 2000;
+    
+    auto timeIt = [](auto&& fn) {
+        auto start = chrono::steady_clock::now();
+        fn();
+        return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    };
+    
+    mt19937 gen(42);
+    vector<int> positions(OPS);
+    for (int& p : positions) p = gen() % (N - 1);
+    
+    SinglyLinkedList list;
+    UnrolledLinkedList unrolled;
+    vector<int> vec;
+    deque<int> dq;
+    long long checks[4] = {0, 0, 0, 0};
+    double build[4], scan[4], access[4], edit[4];
+    
+    // SinglyLinkedList::insertTail is O(n), so build it from the head in reverse
+    build[0] = timeIt([&] { for (int i = N - 1; i >= 0; i--) list.insertHead(i); });
+    build[1] = timeIt([&] { for (int i = 0; i < N; i++) unrolled.insertTail(i); });
+    build[2] = timeIt([&] { for (int i = 0; i < N; i++) vec.push_back(i); });
+    build[3] = timeIt([&] { for (int i = 0; i < N; i++) dq.push_back(i); });
+    
+    scan[0] = timeIt([&] { checks[0] += list.toVector().size() + list.search(-1); });
+    scan[1] = timeIt([&] { checks[1] += unrolled.toVector().size() + unrolled.search(-1); });
+    scan[2] = timeIt([&] { checks[2] += vector<int>(vec).size() + (find(vec.begin(), vec.end(), -1) != vec.end()); });
+    scan[3] = timeIt([&] { checks[3] += vector<int>(dq.begin(), dq.end()).size() + (find(dq.begin(), dq.end(), -1) != dq.end()); });
+    
+    access[0] = timeIt([&] { for (int p : positions) checks[0] += list.get(p); });
+    access[1] = timeIt([&] { for (int p : positions) checks[1] += unrolled.get(p); });
+    access[2] = timeIt([&] { for (int p : positions) checks[2] += vec[p]; });
+    access[3] = timeIt([&] { for (int p : positions) checks[3] += dq[p]; });
+    
+    edit[0] = timeIt([&] { for (int p : positions) { list.insertAt(p, -p); list.deleteAt(p + 1); } });
+    edit[1] = timeIt([&] { for (int p : positions) { unrolled.insertAt(p, -p); unrolled.deleteAt(p + 1); } });
+    edit[2] = timeIt([&] { for (int p : positions) { vec.insert(vec.begin() + p, -p); vec.erase(vec.begin() + p + 1); } });
+    edit[3] = timeIt([&] { for (int p : positions) { dq.insert(dq.begin() + p, -p); dq.erase(dq.begin() + p + 1); } });
+    
+    bool same = list.toVector() == vec && unrolled.toVector() == vec && vector<int>(dq.begin(), dq.end()) == vec
+                && checks[0] == checks[1] && checks[1] == checks[2] && checks[2] == checks[3];
+    
+    const char* names[4] = {"SinglyLinkedList", "UnrolledLinkedList", "std::vector", "std::deque"};
+    cout << N << " elements, " << OPS << " random get / insertAt+deleteAt (ms):" << endl;
+    cout << left << setw(20) << "" << right << setw(10) << "build" << setw(10) << "scan"
+         << setw(10) << "get" << setw(12) << "insert+del" << endl;
+    cout << fixed << setprecision(2);
+    for (int i = 0; i < 4; i++) {
+        cout << left << setw(20) << names[i] << right << setw(10) << build[i] << setw(10) << scan[i]
+             << setw(10) << access[i] << setw(12) << edit[i] << endl;
+    }
+    cout << defaultfloat << setprecision(6);
+    cout << "Unrolled nodes: " << unrolled.getNodeCount() << ", fill " << unrolled.fillRatio() * 100 << "%"
+         << (same ? "" : "  MISMATCH") << endl;
+}
+
+void benchmarkListSort() {
+    cout << "\n=== LIST SORT BENCHMARK ===" << endl;
+    const int N = 2000000;
+    
+    mt19937 gen(7);
+    vector<ListNode*> nodes(N);
+    for (int i = 0; i < N; i++) nodes[i] = new ListNode(0);
+    // Link the nodes in shuffled address order, as a long-lived list would be
+    vector<ListNode*> order(nodes);
+    shuffle(order.begin(), order.end(), gen);
+    
+    auto relink = [&](auto valueOf) {
+        for (int i = 0; i < N; i++) {
+            order[i]->val = valueOf(i);
+            order[i]->next = i + 1 < N ? order[i + 1] : nullptr;
+        }
+        return order[0];
+    };
+    auto isSorted = [](ListNode* head, int expected) {
+        int count = 0;
+        for (ListNode* node = head; node; node = node->next, count++) {
+            if (node->next && node->next->val < node->val) return false;
+        }
+        return count == expected;
+    };
+    
+    const char* inputs[3] = {"random", "nearly sorted", "reversed"};
+    auto makeInput = [&](int kind) {
+        if (kind == 0) return relink([&](int) { return static_cast<int>(gen()); });
+        if (kind == 1) return relink([&](int i) { return gen() % 100 == 0 ? static_cast<int>(gen() % N) : i; });
+        return relink([&](int i) { return N - i; });
+    };
+    
+    struct Method { const char* name; ListNode* (*sort)(ListNode*); };
+    Method methods[3] = {
+        {"top-down recursive", LinkedListAlgorithms::sortListTopDown},
+        {"bottom-up runs", ListSort::sortBottomUp},
+        {"gather + radix", ListSort::sortByGather}
+    };
+    
+    cout << N << " nodes (ms):" << endl;
+    cout << left << setw(20) << "" << right;
+    for (const char* input : inputs) cout << setw(15) << input;
+    cout << endl << fixed << setprecision(1);
+    bool allSorted = true;
+    for (const Method& method : methods) {
+        cout << left << setw(20) << method.name << right;
+        for (int kind = 0; kind < 3; kind++) {
+            ListNode* head = makeInput(kind);
+            auto start = chrono::steady_clock::now();
+            head = method.sort(head);
+            cout << setw(15) << chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+            allSorted = allSorted && isSorted(head, N);
+        }
+        cout << endl;
+    }
+    cout << defaultfloat << setprecision(6) << (allSorted ? "All outputs sorted" : "UNSORTED OUTPUT") << endl;
+    
+    for (ListNode* node : nodes) delete node;
+}
+
+// ========================================================================
+// 6. PARALLEL LIST RANKING AND PREFIX SUMS
+// ========================================================================
+
+/*
+ * THEORY: List Ranking
+ * 
+ * List ranking computes every node's position in its list. Once ranks are
+ * known the list can be scattered into a contiguous array, cut into equal
+ * pieces or indexed directly. A plain walk (getLength, toVector) is a chain
+ * of dependent cache misses that no number of cores can speed up.
+ * 
+ * Both parallel algorithms need to enumerate the nodes without walking
+ * them, so they work on a successor array: next[i] is the index of node
+ * i's successor (NIL at the tail). successorsFromPool builds this array
+ * for ListNodes that live in one contiguous pool (e.g. an arena), using
+ * pointer arithmetic in parallel.
+ * 
+ * 1. Wyllie pointer jumping: every node repeatedly adds its successor's
+ *    distance and jumps to its successor's successor. After log2(n) rounds
+ *    each node knows its distance to the tail. O(n log n) work, simple
+ *    and fully parallel, but every round touches every node.
+ * 
+ * 2. Sparse ruling set: pick the head plus ~n/SPACING random "rulers".
+ *    In parallel, each ruler walks its sublist up to the next ruler and
+ *    labels the nodes with (ruler, offset). The short ruler list is ranked
+ *    serially, then every node's rank is its ruler's rank plus its offset.
+ *    O(n) work; random rulers make sublists ~SPACING nodes long, and there
+ *    are far more sublists than threads, so the load balances itself.
+ *    Each task also interleaves several sublist walks, so even one core
+ *    keeps multiple cache misses in flight, which a single walk cannot.
+ * 
+ * The same three phases compute prefix sums in list order: each sublist
+ * produces local running sums, rulers are scanned, and a fix-up pass adds
+ * each ruler's prefix.
+ * 
+ * next must hold one list through all n slots. findHead throws
+ * invalid_argument unless there is one head and no slot has two
+ * predecessors; a cycle apart from the list passes that local check.
+ * prefixSums (so rankRulingSet) repeats the predecessor check, which keeps
+ * sublist walks disjoint, and throws if the list from head does not reach
+ * every slot, instead of reading slots it never ranked. rankWyllie calls
+ * findHead itself and checks that the head ends n - 1 links from the tail.
+ */
+
+template<typename Fn>
+void parallelFor(size_t tasks, size_t threads, Fn&& fn) {
+    threads = max<size_t>(1, min(threads, tasks));
+    if (threads == 1) {
+        for (size_t t = 0; t < tasks; ++t) fn(t);
+        return;
+    }
+    atomic<size_t> nextTask{0};
+    vector<thread> workers;
+    for (size_t w = 0; w < threads; ++w) {
+        workers.emplace_back([&] {
+            for (size_t t; (t = nextTask.fetch_add(1)) < tasks;) fn(t);
+        });
+    }
+    for (auto& worker : workers) worker.join();
+}
+
+class ListRanking {
+public:
+    static constexpr uint32_t NIL = UINT32_MAX;
+    static constexpr size_t SPACING = 128;  // Expected nodes per ruler
+    static constexpr size_t BLOCK = 1 << 16;  // Nodes per parallel task in flat passes
+    static constexpr size_t WALKERS = 16;  // Sublists walked concurrently per task
+    
+    // Successor indices for nodes stored contiguously in pool[0..n)
+    static vector<uint32_t> successorsFromPool(const ListNode* pool, size_t n, size_t threads) {
+        vector<uint32_t> next(n);
+        parallelFor((n + BLOCK - 1) / BLOCK, threads, [&](size_t b) {
+            for (size_t i = b * BLOCK; i < min(n, (b + 1) * BLOCK); i++) {
+                next[i] = pool[i].next ? static_cast<uint32_t>(pool[i].next - pool) : NIL;
+            }
+        });
+        return next;
+    }
+    
+    // Marks every node's predecessor; throws if a successor is out of range
+    // or two nodes share one, since parallel walks would then overlap
+    static vector<atomic<uint8_t>> markPredecessors(const vector<uint32_t>& next, size_t threads) {
+        size_t n = next.size();
+        vector<atomic<uint8_t>> hasPredecessor(n);
+        atomic<bool> malformed{false};
+        parallelFor((n + BLOCK - 1) / BLOCK, threads, [&](size_t b) {
+            for (size_t i = b * BLOCK; i < min(n, (b + 1) * BLOCK); i++) {
+                if (next[i] == NIL) continue;
+                if (next[i] >= n || hasPredecessor[next[i]].exchange(1, memory_order_relaxed)) {
+                    malformed.store(true, memory_order_relaxed);
+                }
+            }
+        });
+        if (malformed) throw invalid_argument("Successor out of range or shared by two nodes");
+        return hasPredecessor;
+    }
+    
+    // The node nobody points to; throws unless exactly one such node exists
+    static uint32_t findHead(const vector<uint32_t>& next, size_t threads) {
+        size_t n = next.size();
+        if (n == 0) return NIL;
+        vector<atomic<uint8_t>> hasPredecessor = markPredecessors(next, threads);
+        
+        uint32_t head = NIL;
+        for (size_t i = 0; i < n; i++) {
+            if (hasPredecessor[i].load(memory_order_relaxed)) continue;
+            if (head != NIL) throw invalid_argument("More than one list head");
+            head = static_cast<uint32_t>(i);
+        }
+        if (head == NIL) throw invalid_argument("No list head: every node is on a cycle");
+        return head;
+    }
+    
+    // Reference: walk the list - O(n), serial
+    static vector<uint32_t> rankSerial(const vector<uint32_t>& next, uint32_t head) {
+        vector<uint32_t> rank(next.size());
+        uint32_t position = 0;
+        for (uint32_t i = head; i != NIL; i = next[i]) rank[i] = position++;
+        return rank;
+    }
+    
+    // Wyllie pointer jumping - O(n log n) work, O(log n) rounds. Throws
+    // like findHead, and if the list from the head misses any slot.
+    static vector<uint32_t> rankWyllie(const vector<uint32_t>& next, size_t threads) {
+        size_t n = next.size();
+        if (n == 0) return {};
+        uint32_t head = findHead(next, threads);
+        size_t blocks = (n + BLOCK - 1) / BLOCK;
+        vector<uint32_t> jump(next), jumpOut(n);
+        vector<uint32_t> distance(n), distanceOut(n);  // Distance to the tail
+        parallelFor(blocks, threads, [&](size_t b) {
+            for (size_t i = b * BLOCK; i < min(n, (b + 1) * BLOCK); i++) distance[i] = next[i] == NIL ? 0 : 1;
+        });
+        
+        for (size_t span = 1; span < n; span *= 2) {
+            parallelFor(blocks, threads, [&](size_t b) {
+                for (size_t i = b * BLOCK; i < min(n, (b + 1) * BLOCK); i++) {
+                    uint32_t j = jump[i];
+                    if (j == NIL) {
+                        distanceOut[i] = distance[i];
+                        jumpOut[i] = NIL;
+                    } else {
+                        distanceOut[i] = distance[i] + distance[j];
+                        jumpOut[i] = jump[j];
+                    }
+                }
+            });
+            jump.swap(jumpOut);
+            distance.swap(distanceOut);
+        }
+        // Only a list through every slot leaves the head n - 1 links from its tail
+        if (distance[head] != n - 1) throw invalid_argument("List from head does not reach every node");
+        
+        parallelFor(blocks, threads, [&](size_t b) {
+            for (size_t i = b * BLOCK; i < min(n, (b + 1) * BLOCK); i++) {
+                distance[i] = static_cast<uint32_t>(n - 1) - distance[i];
+            }
+        });
+        return distance;
+    }
+    
+    // Sparse ruling set - O(n) work
+    static vector<uint32_t> rankRulingSet(const vector<uint32_t>& next, uint32_t head, size_t threads) {
+        vector<uint32_t> ones(next.size(), 1);
+        vector<uint32_t> inclusive = prefixSums(next, head, ones, threads, plus<uint32_t>(), 0u);
+        size_t n = next.size();
+        parallelFor((n + BLOCK - 1) / BLOCK, threads, [&](size_t b) {
+            for (size_t i = b * BLOCK; i < min(n, (b + 1) * BLOCK); i++) inclusive[i]--;
+        });
+        return inclusive;
+    }
+    
+    /*
+     * Inclusive scan in list order: result[i] = values[head] op ... op values[i].
+     * op must be associative; identity is its neutral element.
+     */
+    template<typename T, typename Op>
+    static vector<T> prefixSums(const vector<uint32_t>& next, uint32_t head, const vector<T>& values,
+                                size_t threads, Op op, T identity) {
+        size_t n = next.size();
+        vector<T> result(n);
+        if (n == 0 || head == NIL) return result;
+        if (head >= n) throw invalid_argument("Head out of range");
+        markPredecessors(next, threads);  // So no two sublist walks can overlap
+        
+        // Choose rulers: the head plus a random sample, deduplicated
+        vector<uint32_t> rulerOf(n, NIL);  // Ruler id for ruler nodes, later for every node
+        vector<uint32_t> rulers = {head};
+        rulerOf[head] = 0;
+        mt19937 gen(static_cast<uint32_t>(n));
+        for (size_t k = 0; k < n / SPACING; k++) {
+            uint32_t candidate = gen() % n;
+            if (rulerOf[candidate] == NIL) {
+                rulerOf[candidate] = static_cast<uint32_t>(rulers.size());
+                rulers.push_back(candidate);
+            }
+        }
+        size_t r = rulers.size();
+        
+        // Phase 1: each ruler scans its sublist up to the next ruler. A task
+        // advances WALKERS sublists in lockstep so their cache misses overlap.
+        vector<uint32_t> nextRuler(r), sublistLength(r);
+        vector<T> sublistTotal(r);
+        vector<uint8_t> isRuler(n, 0);
+        for (uint32_t node : rulers) isRuler[node] = 1;
+        parallelFor((r + 63) / 64, threads, [&](size_t b) {
+            size_t id = b * 64, end = min(r, (b + 1) * 64);
+            uint32_t walkerId[WALKERS], cursor[WALKERS], length[WALKERS];
+            T running[WALKERS];
+            size_t active = 0;
+            while (active > 0 || id < end) {
+                while (active < WALKERS && id < end) {
+                    uint32_t node = rulers[id];
+                    walkerId[active] = static_cast<uint32_t>(id);
+                    running[active] = values[node];
+                    result[node] = running[active];
+                    length[active] = 1;
+                    cursor[active++] = next[node];
+                    id++;
+                }
+                for (size_t w = 0; w < active;) {
+                    uint32_t v = cursor[w];
+                    if (v == NIL || isRuler[v]) {
+                        nextRuler[walkerId[w]] = v == NIL ? NIL : rulerOf[v];
+                        sublistTotal[walkerId[w]] = running[w];
+                        sublistLength[walkerId[w]] = length[w];
+                        active--;
+                        walkerId[w] = walkerId[active];
+                        cursor[w] = cursor[active];
+                        running[w] = running[active];
+                        length[w] = length[active];
+                        continue;
+                    }
+                    running[w] = op(running[w], values[v]);
+                    result[v] = running[w];
+                    rulerOf[v] = walkerId[w];
+                    cursor[w] = next[v];
+                    length[w]++;
+                    w++;
+                }
+            }
+        });
+        
+        // Phase 2: exclusive scan over the short ruler list. The sublists on
+        // it are consecutive pieces of head's list, so their lengths add up
+        // to n exactly when that list reaches every slot.
+        vector<T> rulerPrefix(r, identity);
+        T running = identity;
+        size_t reached = 0, steps = 0;
+        for (uint32_t id = 0; id != NIL; id = nextRuler[id]) {
+            if (++steps > r) throw invalid_argument("List from head has a cycle");
+            rulerPrefix[id] = running;
+            running = op(running, sublistTotal[id]);
+            reached += sublistLength[id];
+        }
+        if (reached != n) throw invalid_argument("List from head does not reach every node");
+        
+        // Phase 3: add each node's ruler prefix
+        parallelFor((n + BLOCK - 1) / BLOCK, threads, [&](size_t b) {
+            for (size_t i = b * BLOCK; i < min(n, (b + 1) * BLOCK); i++) {
+                result[i] = op(rulerPrefix[rulerOf[i]], result[i]);
+            }
+        });
+        return result;
+    }
+    
+    // Scatter values into list order using ranks - the contiguous "toVector"
+    template<typename T>
+    static vector<T> toArray(const vector<uint32_t>& rank, const vector<T>& values, size_t threads) {
+        size_t n = rank.size();
+        vector<T> out(n);
+        parallelFor((n + BLOCK - 1) / BLOCK, threads, [&](size_t b) {
+            for (size_t i = b * BLOCK; i < min(n, (b + 1) * BLOCK); i++) out[rank[i]] = values[i];
+        });
+        return out;
+    }
+};
+
+void benchmarkListRanking() {
+    cout << "\n=== PARALLEL LIST RANKING BENCHMARK ===" << endl;
+    const size_t N = 4000000;
+    
+    // Pool-allocated nodes linked in random order, like a long-lived event chain
+    vector<ListNode> pool(N);
+    vector<uint32_t> order(N);
+    for (size_t i = 0; i < N; i++) order[i] = static_cast<uint32_t>(i);
+    shuffle(order.begin(), order.end(), mt19937(13));
+    vector<long long> values(N);
+    for (size_t k = 0; k < N; k++) {
+        pool[order[k]].val = static_cast<int>(k % 1000);
+        pool[order[k]].next = k + 1 < N ? &pool[order[k + 1]] : nullptr;
+    }
+    for (size_t i = 0; i < N; i++) values[i] = pool[i].val;
+    ListNode* head = &pool[order[0]];
+    
+    auto timeIt = [](auto&& fn) {
+        auto start = chrono::steady_clock::now();
+        fn();
+        return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    };
+    
+    size_t hardware = max(1u, thread::hardware_concurrency());
+    vector<uint32_t> next, expected, rank;
+    vector<long long> sums, expectedSums;
+    
+    double walk = timeIt([&] { expected = ListRanking::rankSerial(ListRanking::successorsFromPool(pool.data(), N, 1), order[0]); });
+    double serialScan = timeIt([&] {
+        expectedSums.assign(N, 0);
+        long long running = 0;
+        for (ListNode* node = head; node; node = node->next) {
+            running += node->val;
+            expectedSums[node - pool.data()] = running;
+        }
+    });
+    cout << N << " nodes, hardware threads: " << hardware << endl;
+    cout << fixed << setprecision(1);
+    cout << "  serial walk rank: " << walk << " ms, serial walk prefix sums: " << serialScan << " ms" << endl;
+    
+    bool ok = true;
+    for (size_t threads : {size_t(1), size_t(2), size_t(4), hardware}) {
+        double build = timeIt([&] { next = ListRanking::successorsFromPool(pool.data(), N, threads); });
+        uint32_t first = ListRanking::findHead(next, threads);
+        double wyllie = timeIt([&] { rank = ListRanking::rankWyllie(next, threads); });
+        ok = ok && rank == expected;
+        double ruling = timeIt([&] { rank = ListRanking::rankRulingSet(next, first, threads); });
+        ok = ok && rank == expected;
+        double scan = timeIt([&] {
+            sums = ListRanking::prefixSums(next, first, values, threads, plus<long long>(), 0LL);
+        });
+        ok = ok && sums == expectedSums;
+        cout << "  " << threads << " threads: successors " << setw(6) << build << ", Wyllie " << setw(7) << wyllie
+             << ", ruling set " << setw(6) << ruling << ", prefix sums " << setw(6) << scan << " ms" << endl;
+    }
+    cout << defaultfloat << setprecision(6);
+    cout << "All results match the serial walk: " << (ok ? "Yes" : "No") << endl;
+}
+
+// ========================================================================
+// 7. ARENA-BACKED LIST WITH 32-BIT HANDLES
+// ========================================================================
+
+/*
+ * THEORY: Arena Allocation and Node Handles
+ * 
+ * SinglyLinkedList calls new/delete once per node. Each ListNode is 16
+ * bytes, but the heap adds a header and rounds up, so it really costs
+ * 32 bytes. Nodes land wherever the allocator puts them, and clear()
+ * must visit and free every node.
+ * 
+ * HandleArena stores nodes in one growing vector and names them by 32-bit
+ * index ("handle") instead of a 64-bit pointer:
+ * - A node shrinks to 8 bytes (int value + uint32_t next) with no heap
+ *   header, and consecutive inserts sit next to each other in memory.
+ * - Handles stay valid when the vector grows, unlike raw pointers.
+ * - Released nodes form a free list threaded through their next field,
+ *   so allocate/release are O(1) and reuse memory without the heap.
+ * - A list that knows its tail can give back its whole chain in O(1)
+ *   (tail.next = freeHead; freeHead = head), so clear() is O(1).
+ * 
+ * Several lists may share one arena; each list then clears in O(1)
+ * without disturbing the others.
+ */
+
+template<typename Node>
+class HandleArena {
+private:
+    vector<Node> nodes;
+    uint32_t freeHead;
+    size_t live = 0;
+    
+public:
+    static constexpr uint32_t NIL = UINT32_MAX;
+    
+    HandleArena() : freeHead(NIL) {}
+    
+    // O(1) amortized: reuses a released node if there is one
+    uint32_t allocate() {
+        if (freeHead != NIL) {
+            uint32_t handle = freeHead;
+            freeHead = nodes[handle].next;
+            live++;
+            return handle;
+        }
+        if (nodes.size() >= NIL) throw length_error("Arena is out of handles");
+        nodes.emplace_back();  // Counted only once it succeeded
+        live++;
+        return static_cast<uint32_t>(nodes.size() - 1);
+    }
+    
+    void release(uint32_t handle) {
+        nodes[handle].next = freeHead;
+        freeHead = handle;
+        live--;
+    }
+    
+    // Returns a chain first..last of count nodes linked through next - O(1)
+    void releaseChain(uint32_t first, uint32_t last, size_t count) {
+        nodes[last].next = freeHead;
+        freeHead = first;
+        live -= count;
+    }
+    
+    void reserve(size_t count) { nodes.reserve(count); }
+    
+    Node& operator[](uint32_t handle) { return nodes[handle]; }
+    const Node& operator[](uint32_t handle) const { return nodes[handle]; }
+    
+    size_t liveNodes() const { return live; }
+    size_t bytesReserved() const { return nodes.capacity() * sizeof(Node); }
+};
+
+struct ArenaListNode {
+    int val;
+    uint32_t next;
+};
+
+class ArenaSinglyLinkedList {
+public:
+    using Arena = HandleArena<ArenaListNode>;
+    static constexpr uint32_t NIL = Arena::NIL;
+    
+private:
+    unique_ptr<Arena> ownedArena;
+    Arena* arena;
+    uint32_t head = NIL;
+    uint32_t tail = NIL;
+    int size = 0;
+    
+    uint32_t newNode(int val, uint32_t next) {
+        uint32_t handle = arena->allocate();
+        (*arena)[handle] = ArenaListNode{val, next};
+        return handle;
+    }
+    
+public:
+    // Uses a private arena
+    ArenaSinglyLinkedList() : ownedArena(new Arena), arena(ownedArena.get()) {}
+    
+    // Draws nodes from an arena shared with other lists
+    explicit ArenaSinglyLinkedList(Arena& shared) : arena(&shared) {}
+    
+    ~ArenaSinglyLinkedList() {
+        clear();
+    }
+    
+    ArenaSinglyLinkedList(const ArenaSinglyLinkedList&) = delete;
+    ArenaSinglyLinkedList& operator=(const ArenaSinglyLinkedList&) = delete;
+    
+    // Insert at head - O(1)
+    void insertHead(int val) {
+        head = newNode(val, head);
+        if (tail == NIL) tail = head;
+        size++;
+    }
+    
+    // Insert at tail - O(1), the arena list keeps a tail handle
+    void insertTail(int val) {
+        uint32_t handle = newNode(val, NIL);
+        if (tail == NIL) {
+            head = handle;
+        } else {
+            (*arena)[tail].next = handle;
+        }
+        tail = handle;
+        size++;
+    }
+    
+    // Insert at position - O(n)
+    void insertAt(int pos, int val) {
+        if (pos < 0 || pos > size) throw out_of_range("Position out of bounds");
+        if (pos == 0) return insertHead(val);
+        if (pos == size) return insertTail(val);
+        
+        uint32_t prev = head;
+        for (int i = 0; i < pos - 1; i++) prev = (*arena)[prev].next;
+        uint32_t handle = newNode(val, (*arena)[prev].next);
+        (*arena)[prev].next = handle;
+        size++;
+    }
+    
+    // Delete head - O(1)
+    bool deleteHead() {
+        if (head == NIL) return false;
+        uint32_t old = head;
+        head = (*arena)[old].next;
+        if (head == NIL) tail = NIL;
+        arena->release(old);
+        size--;
+        return true;
+    }
+    
+    // Delete at position - O(n)
+    bool deleteAt(int pos) {
+        if (pos < 0 || pos >= size) return false;
+        if (pos == 0) return deleteHead();
+        
+        uint32_t prev = head;
+        for (int i = 0; i < pos - 1; i++) prev = (*arena)[prev].next;
+        uint32_t victim = (*arena)[prev].next;
+        (*arena)[prev].next = (*arena)[victim].next;
+        if (victim == tail) tail = prev;
+        arena->release(victim);
+        size--;
+        return true;
+    }
+    
+    // Delete tail - O(n), a singly linked list cannot step back from the tail
+    bool deleteTail() {
+        return deleteAt(size - 1);
+    }
+    
+    // Delete first occurrence of val - O(n)
+    bool deleteByValue(int val) {
+        int pos = 0;
+        for (uint32_t h = head; h != NIL; h = (*arena)[h].next, pos++) {
+            if ((*arena)[h].val == val) return deleteAt(pos);
+        }
+        return false;
+    }
+    
+    // Search for value - O(n)
+    bool search(int val) const {
+        for (uint32_t h = head; h != NIL; h = (*arena)[h].next) {
+            if ((*arena)[h].val == val) return true;
+        }
+        return false;
+    }
+    
+    // Get value at position - O(n)
+    int get(int pos) const {
+        if (pos < 0 || pos >= size) throw out_of_range("Position out of bounds");
+        uint32_t h = head;
+        for (int i = 0; i < pos; i++) h = (*arena)[h].next;
+        return (*arena)[h].val;
+    }
+    
+    int getSize() const { return size; }
+    bool isEmpty() const { return head == NIL; }
+    
+    // Clear all nodes - O(1): the chain is handed back to the arena whole
+    void clear() {
+        if (head != NIL) arena->releaseChain(head, tail, size);
+        head = tail = NIL;
+        size = 0;
+    }
+    
+    void display() const {
+        cout << "Arena list: ";
+        for (uint32_t h = head; h != NIL; h = (*arena)[h].next) {
+            cout << (*arena)[h].val;
+            if ((*arena)[h].next != NIL) cout << " -> ";
+        }
+        cout << " -> null" << endl;
+    }
+    
+    vector<int> toVector() const {
+        vector<int> result;
+        result.reserve(size);
+        for (uint32_t h = head; h != NIL; h = (*arena)[h].next) result.push_back((*arena)[h].val);
+        return result;
+    }
+    
+    const Arena& getArena() const { return *arena; }
+};
+
+// Bytes currently allocated from the heap, where the C library can report it
+size_t heapBytesInUse() {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    return mallinfo2().uordblks;
+#else
+    return 0;
+#endif
+}
+
+void benchmarkArenaList() {
+    cout << "\n=== ARENA LIST BENCHMARK ===" << endl;
+    const int N = 2000000;
+    
+    auto timeIt = [](auto&& fn) {
+        auto start = chrono::steady_clock::now();
+        fn();
+        return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    };
+    
+    double insertTime[3], clearTime[3], scanTime[3], bytesPerNode[3];
+    long long checks[3] = {0, 0, 0};
+    
+    {
+        SinglyLinkedList list;
+        size_t before = heapBytesInUse();
+        insertTime[0] = timeIt([&] { for (int i = 0; i < N; i++) list.insertHead(i); });
+        bytesPerNode[0] = static_cast<double>(heapBytesInUse() - before) / N;
+        scanTime[0] = timeIt([&] { checks[0] = list.search(-1) + list.getSize(); });
+        clearTime[0] = timeIt([&] { list.clear(); });
+    }
+    {
+        ArenaSinglyLinkedList list;
+        size_t before = heapBytesInUse();
+        insertTime[1] = timeIt([&] { for (int i = 0; i < N; i++) list.insertHead(i); });
+        bytesPerNode[1] = static_cast<double>(heapBytesInUse() - before) / N;
+        scanTime[1] = timeIt([&] { checks[1] = list.search(-1) + list.getSize(); });
+        clearTime[1] = timeIt([&] { list.clear(); });
+        
+        // Refill reuses the released chain: no growth, no heap calls
+        insertTime[2] = timeIt([&] { for (int i = 0; i < N; i++) list.insertHead(i); });
+        bytesPerNode[2] = static_cast<double>(list.getArena().bytesReserved()) / N;
+        scanTime[2] = timeIt([&] { checks[2] = list.search(-1) + list.getSize(); });
+        clearTime[2] = timeIt([&] { list.clear(); });
+    }
+    
+    const char* names[3] = {"SinglyLinkedList", "Arena list (fresh)", "Arena list (reuse)"};
+    cout << N << " insertHead, search miss, clear:" << endl;
+    cout << left << setw(22) << "" << right << setw(12) << "bytes/node" << setw(12) << "insert ms"
+         << setw(12) << "scan ms" << setw(12) << "clear ms" << endl;
+    cout << fixed;
+    for (int i = 0; i < 3; i++) {
+        cout << left << setw(22) << names[i] << right << setprecision(1) << setw(12) << bytesPerNode[i]
+             << setw(12) << insertTime[i] << setw(12) << scanTime[i] << setprecision(3) << setw(12) << clearTime[i]
+             << endl;
+    }
+    cout << defaultfloat << setprecision(6);
+    if (heapBytesInUse() == 0) cout << "(heap statistics unavailable on this platform)" << endl;
+    cout << "Results agree: " << (checks[0] == checks[1] && checks[1] == checks[2] ? "Yes" : "No") << endl;
+}
+
+// ========================================================================
+// 8. DEMONSTRATION AND TESTING
 // ========================================================================
 
 void demonstrateBasicOperations() {
@@ -747,6 +1936,25 @@ void demonstrateAdvancedAlgorithms() {
     LinkedListUtils::deleteList(merged);
 }
 
+void demonstrateUnrolledList() {
+    cout << "\n=== UNROLLED LINKED LIST ===" << endl;
+    
+    UnrolledLinkedList list;
+    for (int i = 1; i <= 130; i++) list.insertTail(i);
+    list.insertHead(0);
+    list.insertAt(65, -1);
+    cout << "Size: " << list.getSize() << ", nodes: " << list.getNodeCount()
+         << " (" << UnrolledLinkedList::CAPACITY << " values each)" << endl;
+    cout << "get(65) = " << list.get(65) << ", get(130) = " << list.get(130) << endl;
+    
+    for (int i = 0; i < 100; i++) list.deleteAt(1);
+    cout << "After deleting 100 from the front: ";
+    list.display();
+    cout << "Search 120: " << (list.search(120) ? "Found" : "Not found") << endl;
+    
+    benchmarkUnrolledList();
+}
+
 void demonstrateComplexOperations() {
     cout << "\n=== COMPLEX LINKED LIST OPERATIONS ===" << endl;
     
@@ -759,6 +1967,12 @@ void demonstrateComplexOperations() {
     cout << "After sorting: ";
     LinkedListUtils::printList(head);
     
+    head = LinkedListUtils::createFromVector({9, 8, 7, 1, 2, 3, -4, 6, 5, 0});
+    head = ListSort::sortByGather(head);
+    cout << "Gather + radix sort: ";
+    LinkedListUtils::printList(head);
+    LinkedListUtils::deleteList(head);
+    
     // Test remove nth from end
     head = LinkedListUtils::createFromVector({1, 2, 3, 4, 5});
     cout << "Before removing 2nd from end: ";
@@ -786,6 +2000,88 @@ void demonstrateComplexOperations() {
 // MAIN FUNCTION - COMPREHENSIVE DEMONSTRATION
 // ========================================================================
 
+void demonstrateListRanking() {
+    cout << "\n=== PARALLEL LIST RANKING ===" << endl;
+    
+    // Nodes in a pool, linked out of pool order: 3 -> 0 -> 4 -> 1 -> 2
+    vector<ListNode> pool(5);
+    int linkOrder[5] = {3, 0, 4, 1, 2};
+    for (int k = 0; k < 5; k++) {
+        pool[linkOrder[k]].val = (k + 1) * 10;
+        pool[linkOrder[k]].next = k + 1 < 5 ? &pool[linkOrder[k + 1]] : nullptr;
+    }
+    
+    vector<uint32_t> next = ListRanking::successorsFromPool(pool.data(), pool.size(), 2);
+    uint32_t head = ListRanking::findHead(next, 2);
+    vector<uint32_t> rank = ListRanking::rankRulingSet(next, head, 2);
+    vector<int> values;
+    for (const ListNode& node : pool) values.push_back(node.val);
+    
+    cout << "List order: ";
+    LinkedListUtils::printList(&pool[head]);
+    cout << "Rank of pool slots 0..4: ";
+    for (uint32_t r : rank) cout << r << " ";
+    cout << endl;
+    cout << "Wyllie ranks agree: " << (ListRanking::rankWyllie(next, 2) == rank ? "Yes" : "No") << endl;
+    cout << "Contiguous array: ";
+    for (int v : ListRanking::toArray(rank, values, 2)) cout << v << " ";
+    cout << endl;
+    cout << "Prefix sums by pool slot: ";
+    for (int v : ListRanking::prefixSums(next, head, values, 2, plus<int>(), 0)) cout << v << " ";
+    cout << endl;
+    
+    // Malformed successor arrays, large enough that random rulers land off
+    // head's list: two interleaved lists, a tail looping back into the
+    // list, a separate cycle (which findHead cannot see), a shared
+    // successor and an index past the end
+    const uint32_t N = 20000, NIL = ListRanking::NIL;
+    auto chain = [&](uint32_t step) {
+        vector<uint32_t> s(N);
+        for (uint32_t i = 0; i < N; i++) s[i] = i + step < N ? i + step : NIL;
+        return s;
+    };
+    vector<vector<uint32_t>> malformed = {chain(2), chain(1), chain(1), chain(1), chain(1)};
+    malformed[1][N - 1] = N / 2;
+    malformed[2][N / 2 - 1] = NIL;
+    malformed[2][N - 1] = N / 2;
+    malformed[3][N - 2] = 5;
+    malformed[4][N / 2] = N;
+    int findHeadRejects = 0, prefixSumsRejects = 0, wyllieRejects = 0;
+    for (const auto& bad : malformed) {
+        try { ListRanking::findHead(bad, 4); } catch (const invalid_argument&) { findHeadRejects++; }
+        try {
+            ListRanking::rankRulingSet(bad, 0, 4);
+        } catch (const invalid_argument&) { prefixSumsRejects++; }
+        try { ListRanking::rankWyllie(bad, 4); } catch (const invalid_argument&) { wyllieRejects++; }
+    }
+    cout << "Malformed inputs rejected by findHead: " << findHeadRejects << "/" << malformed.size()
+         << ", by rankRulingSet from slot 0: " << prefixSumsRejects << "/" << malformed.size()
+         << ", by rankWyllie: " << wyllieRejects << "/" << malformed.size() << endl;
+    
+    benchmarkListRanking();
+}
+
+void demonstrateArenaList() {
+    cout << "\n=== ARENA-BACKED LIST ===" << endl;
+    
+    ArenaSinglyLinkedList::Arena shared;
+    ArenaSinglyLinkedList evens(shared), odds(shared);
+    for (int i = 0; i < 10; i++) (i % 2 ? odds : evens).insertTail(i);
+    evens.insertAt(2, 99);
+    evens.deleteByValue(4);
+    evens.display();
+    odds.display();
+    cout << "odds.get(3) = " << odds.get(3) << ", nodes in shared arena: " << shared.liveNodes() << endl;
+    
+    odds.clear();  // O(1): the whole chain goes to the free list
+    cout << "After odds.clear(): " << shared.liveNodes() << " live nodes, ";
+    for (int i = 0; i < 3; i++) odds.insertHead(i * 100);
+    cout << "refilled odds reuses freed slots (" << shared.bytesReserved() / sizeof(ArenaListNode) << " slots reserved)" << endl;
+    odds.display();
+    
+    benchmarkArenaList();
+}
+
 int main() {
     cout << "SINGLY LINKED LIST - COMPREHENSIVE IMPLEMENTATION" << endl;
     cout << "================================================" << endl;
@@ -794,12 +2090,20 @@ int main() {
         demonstrateBasicOperations();
         demonstrateAdvancedAlgorithms();
         demonstrateComplexOperations();
+        demonstrateUnrolledList();
+        benchmarkListSort();
+        demonstrateListRanking();
+        demonstrateArenaList();
         
         cout << "\n=== SUMMARY ===" << endl;
         cout << "✓ Basic operations (insert, delete, search)" << endl;
         cout << "✓ Advanced algorithms (reverse, cycle detection)" << endl;
         cout << "✓ Complex operations (merge, sort, palindrome)" << endl;
         cout << "✓ Utility functions for testing and debugging" << endl;
+        cout << "✓ Unrolled linked list (cache-friendly blocks)" << endl;
+        cout << "✓ Bottom-up natural-run merge sort and gather-sort-relink" << endl;
+        cout << "✓ Parallel list ranking and prefix sums" << endl;
+        cout << "✓ Arena-backed list with 32-bit handles and O(1) clear" << endl;
         
     } catch (const exception& e) {
         cerr << "Error: " << e.what() << endl;
@@ -812,7 +2116,7 @@ int main() {
 /*
  * COMPILATION AND EXECUTION:
  * 
- * To compile: g++ -std=c++17 -O2 -o singly_linked_list singly_linked_list.cpp
+ * To compile: g++ -std=c++17 -O2 -pthread -o singly_linked_list singly_linked_list.cpp
  * To run: ./singly_linked_list
  * 
  * TIME COMPLEXITY SUMMARY:
@@ -826,12 +2130,16 @@ int main() {
  * - Reverse: O(n)
  * - Cycle detection: O(n)
  * - Merge sorted: O(n+m)
- * - Sort: O(n log n)
+ * - Sort: O(n log n), O(n log r) for r natural runs; gather + radix: O(n)
+ * - Unrolled list get/insertAt/deleteAt: O(n / CAPACITY + CAPACITY)
+ * - List ranking: Wyllie O(n log n) work, ruling set O(n) work; O(n / p) per core
+ * - Prefix sums in list order: O(n) work
+ * - Arena list insertHead/insertTail/clear: O(1), 8 bytes per node
  * 
  * SPACE COMPLEXITY:
  * - Most operations: O(1) auxiliary space
  * - Recursive operations: O(n) due to recursion stack
- * - Sorting: O(log n) due to recursion
+ * - Sorting: O(1) bottom-up, O(log n) top-down recursion, O(n) gather + radix
  * 
  * NEXT STEPS:
  * 1. Practice implementing from memory
@@ -0,0 +1,839 @@
+/*
+ * SKIP LIST - ORDERED CONTAINER BUILT FROM LINKED LISTS
+ * =====================================================
+ *
+ * This file builds a sorted index on top of the linked-list ideas from
+ * singly_linked_list.cpp: a skip list is a stack of sorted linked lists in
+ * which every level skips over roughly 3 of every 4 nodes of the level
+ * below, so search, insert and erase take O(log n) expected time instead
+ * of the O(n) walk of SinglyLinkedList::search.
+ *
+ * TOPICS COVERED:
+ * 1. Arena node pool with inline level arrays
+ * 2. Skip list with ordered insert, erase, lower_bound and range iteration
+ * 3. Rank and select queries with span-counting links
+ * 4. Finger search for streaming (nearly sorted) inserts
+ * 5. Concurrent skip list with lock-free insertion
+ * 6. Benchmarks against std::set
+ *
+ * LEARNING OBJECTIVES:
+ * - See how randomization replaces rebalancing
+ * - Lay out variable-height nodes in one allocation
+ * - Exploit locality of successive operations
+ * - Publish nodes safely with compare-and-swap
+ *
+ * PREREQUISITES:
+ * - singly_linked_list.cpp (pointer manipulation, dummy head nodes)
+ * - Basic understanding of std::atomic
+ */
+
+#include <iostream>
+#include <vector>
+#include <set>
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <new>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <chrono>
+#include <random>
+#include <iomanip>
+#include <cstdint>
+#include <cstddef>
+
+using namespace std;
+
+// ========================================================================
+// 1. ARENA NODE POOL
+// ========================================================================
+
+/*
+ * THEORY: Arena Allocation for Skip List Nodes
+ *
+ * A skip list node has a variable number of forward links. Allocating the
+ * key and a separate vector of links costs two heap allocations and an
+ * extra pointer hop per level. Instead each node is a single block:
+ *
+ *   [ key | height | link[0] | link[1] | ... | link[height-1] ]
+ *
+ * and blocks are carved sequentially from 64 KB chunks. Nodes created
+ * close together in time (a stream of inserts) end up close together in
+ * memory, allocation is a pointer bump, and destroying the list frees a
+ * handful of chunks instead of n nodes. Erased nodes go onto a per-height
+ * free list and are reused by later inserts of the same height.
+ */
+
+class NodeArena {
+private:
+    static const size_t CHUNK_SIZE = 1 << 16;
+
+    vector<unique_ptr<char[]>> chunks;
+    size_t used = CHUNK_SIZE;
+
+public:
+    // Bump-allocates bytes aligned for any fundamental type
+    void* allocate(size_t bytes) {
+        const size_t align = alignof(max_align_t);
+        bytes = (bytes + align - 1) / align * align;
+        if (bytes > CHUNK_SIZE) throw length_error("Arena allocation larger than a chunk");
+        if (used + bytes > CHUNK_SIZE) {
+            chunks.emplace_back(new char[CHUNK_SIZE]);
+            used = 0;
+        }
+        void* p = chunks.back().get() + used;
+        used += bytes;
+        return p;
+    }
+
+    size_t bytesReserved() const { return chunks.size() * CHUNK_SIZE; }
+};
+
+// ========================================================================
+// 2. SKIP LIST (ORDERED SET WITH RANK QUERIES AND FINGER SEARCH)
+// ========================================================================
+
+/*
+ * THEORY: Skip List
+ *
+ * Level 0 is an ordinary sorted singly linked list. Each node is also
+ * promoted to level i+1 with probability 1/4, so level i holds about
+ * n / 4^i nodes. A search starts at the top level of the head node, moves
+ * right while the next key is smaller than the target, then drops a level.
+ * Expected cost: O(log n) comparisons, with no rotations or rebalancing.
+ *
+ * Rank queries: every link also stores its span, the number of level-0
+ * steps it jumps. Summing spans along the search path gives the position
+ * of the key (rank), and following spans from the head finds the k-th
+ * key (select), both in O(log n) expected.
+ *
+ * Finger search: the search path (the predecessor at each level and its
+ * rank) is kept after every operation. If the next key is larger than the
+ * last one, the search climbs from the finger only as high as needed and
+ * descends from there, costing O(log d) for a key d positions away instead
+ * of O(log n). Streaming inserts of nearly sorted keys hit this case.
+ * It is off by default (setFingerSearch(true) turns it on): for keys in
+ * random order the climb nearly always reaches the top level, so it only
+ * adds comparisons to what a search from the head would do.
+ *
+ * Because lookups update the finger, even read operations are non-const
+ * and a SkipList must not be shared between threads without a lock.
+ */
+
+template<typename Key, typename Compare = less<Key>>
+class SkipList {
+public:
+    static const int MAX_LEVEL = 32;
+
+private:
+    struct Node;
+
+    struct Link {
+        Node* next;
+        size_t span;  // Level-0 steps covered by this link
+    };
+
+    // Allocated with room for `height` links; links[] runs past the struct
+    struct Node {
+        Key key;
+        int height;
+        Link links[1];
+    };
+
+    NodeArena arena;
+    Node* head;
+    Node* freeNodes[MAX_LEVEL + 1] = {};  // Recycled nodes by height
+    int level = 1;
+    size_t count = 0;
+    Compare less;
+    uint64_t rngState;
+    bool useFinger = false;
+
+    // Search path of the last operation: predecessor and its rank per level
+    Node* finger[MAX_LEVEL];
+    size_t fingerRank[MAX_LEVEL];
+
+    Node* allocateNode(const Key& key, int height) {
+        void* memory;
+        if (freeNodes[height]) {
+            memory = freeNodes[height];
+            freeNodes[height] = freeNodes[height]->links[0].next;
+        } else {
+            memory = arena.allocate(offsetof(Node, links) + height * sizeof(Link));
+        }
+        Node* node = static_cast<Node*>(memory);
+        new (&node->key) Key(key);
+        node->height = height;
+        return node;
+    }
+
+    void releaseNode(Node* node) {
+        node->key.~Key();
+        node->links[0].next = freeNodes[node->height];
+        freeNodes[node->height] = node;
+    }
+
+    // Geometric height with p = 1/4 from one 64-bit xorshift draw
+    int randomHeight() {
+        rngState ^= rngState << 13;
+        rngState ^= rngState >> 7;
+        rngState ^= rngState << 17;
+        uint64_t bits = rngState;
+        int height = 1;
+        while (height < MAX_LEVEL && (bits & 3) == 0) {
+            height++;
+            bits >>= 2;
+        }
+        return height;
+    }
+
+    void resetFinger() {
+        for (int i = 0; i < MAX_LEVEL; i++) {
+            finger[i] = head;
+            fingerRank[i] = 0;
+        }
+    }
+
+    /*
+     * Fills finger[] with the last node < key at every level (and its rank,
+     * head = 0) and returns the first node >= key, or nullptr.
+     */
+    Node* findPath(const Key& key) {
+        int top = level - 1;
+        Node* x = head;
+        size_t rank = 0;
+
+        if (useFinger && (finger[0] == head || less(finger[0]->key, key))) {
+            // Every finger node is < key, so climb only while the next node
+            // one level up is still before the key
+            int start = 0;
+            while (start < top) {
+                Node* next = finger[start + 1]->links[start + 1].next;
+                if (!next || !less(next->key, key)) break;
+                start++;
+            }
+            top = start;
+            x = finger[top];
+            rank = fingerRank[top];
+        }
+
+        for (int i = top; i >= 0; i--) {
+            while (x->links[i].next && less(x->links[i].next->key, key)) {
+                rank += x->links[i].span;
+                x = x->links[i].next;
+            }
+            finger[i] = x;
+            fingerRank[i] = rank;
+        }
+        return x->links[0].next;
+    }
+
+    bool matches(Node* node, const Key& key) const {
+        return node && !less(key, node->key);
+    }
+
+public:
+    // Forward iterator over level 0
+    class Iterator {
+    private:
+        Node* node;
+
+    public:
+        explicit Iterator(Node* n) : node(n) {}
+
+        bool valid() const { return node != nullptr; }
+        const Key& key() const { return node->key; }
+        void next() { node = node->links[0].next; }
+    };
+
+    explicit SkipList(uint64_t seed = 0x9E3779B97F4A7C15ULL) : rngState(seed | 1) {
+        head = static_cast<Node*>(arena.allocate(offsetof(Node, links) + MAX_LEVEL * sizeof(Link)));
+        new (&head->key) Key();
+        head->height = MAX_LEVEL;
+        for (int i = 0; i < MAX_LEVEL; i++) head->links[i] = Link{nullptr, 0};
+        resetFinger();
+    }
+
+    ~SkipList() {
+        // Keys live in the arena; only their destructors need running
+        for (Node* x = head->links[0].next; x; x = x->links[0].next) x->key.~Key();
+        head->key.~Key();
+    }
+
+    SkipList(const SkipList&) = delete;
+    SkipList& operator=(const SkipList&) = delete;
+
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    size_t bytesReserved() const { return arena.bytesReserved(); }
+
+    // Opt in for nearly sorted access; when off every search starts from the head
+    void setFingerSearch(bool enabled) {
+        useFinger = enabled;
+        resetFinger();
+    }
+
+    // Inserts key if absent - O(log n) expected, O(log d) with a nearby finger
+    bool insert(const Key& key) {
+        Node* candidate = findPath(key);
+        if (matches(candidate, key)) return false;
+
+        int height = randomHeight();
+        if (height > level) {
+            for (int i = level; i < height; i++) {
+                finger[i] = head;
+                fingerRank[i] = 0;
+                head->links[i].span = count;
+            }
+            level = height;
+        }
+
+        Node* node = allocateNode(key, height);
+        size_t rank = fingerRank[0];
+        for (int i = 0; i < height; i++) {
+            Link& link = finger[i]->links[i];
+            node->links[i].next = link.next;
+            node->links[i].span = link.span - (rank - fingerRank[i]);
+            link.next = node;
+            link.span = rank - fingerRank[i] + 1;
+        }
+        for (int i = height; i < level; i++) finger[i]->links[i].span++;
+        count++;
+        return true;
+    }
+
+    // Removes key if present - O(log n) expected
+    bool erase(const Key& key) {
+        Node* target = findPath(key);
+        if (!matches(target, key)) return false;
+
+        for (int i = 0; i < level; i++) {
+            Link& link = finger[i]->links[i];
+            if (link.next == target) {
+                link.span += target->links[i].span - 1;
+                link.next = target->links[i].next;
+            } else {
+                link.span--;
+            }
+        }
+        while (level > 1 && !head->links[level - 1].next) level--;
+        releaseNode(target);
+        count--;
+        return true;
+    }
+
+    bool contains(const Key& key) {
+        return matches(findPath(key), key);
+    }
+
+    // First element not less than key
+    Iterator lowerBound(const Key& key) {
+        return Iterator(findPath(key));
+    }
+
+    Iterator begin() const {
+        return Iterator(head->links[0].next);
+    }
+
+    // Number of elements less than key - O(log n) expected
+    size_t rank(const Key& key) {
+        findPath(key);
+        return fingerRank[0];
+    }
+
+    // k-th smallest element (0-based) - O(log n) expected
+    const Key& select(size_t k) const {
+        if (k >= count) throw out_of_range("Rank out of range");
+        Node* x = head;
+        size_t position = 0;
+        for (int i = level - 1; i >= 0; i--) {
+            while (x->links[i].next && position + x->links[i].span <= k + 1) {
+                position += x->links[i].span;
+                x = x->links[i].next;
+            }
+        }
+        return x->key;
+    }
+
+    // Calls fn on every element in [low, high) in order
+    template<typename Fn>
+    void forEachInRange(const Key& low, const Key& high, Fn fn) {
+        for (Node* x = findPath(low); x && less(x->key, high); x = x->links[0].next) fn(x->key);
+    }
+
+    // Number of elements in [low, high) - two rank queries
+    size_t countInRange(const Key& low, const Key& high) {
+        if (!less(low, high)) return 0;
+        size_t below = rank(low);
+        return rank(high) - below;
+    }
+
+    vector<Key> toVector() const {
+        vector<Key> result;
+        result.reserve(count);
+        for (Node* x = head->links[0].next; x; x = x->links[0].next) result.push_back(x->key);
+        return result;
+    }
+
+    // Print every level, top first
+    void display() const {
+        for (int i = level - 1; i >= 0; i--) {
+            cout << "Level " << i << ": head";
+            for (Node* x = head->links[i].next; x; x = x->links[i].next) cout << " -> " << x->key;
+            cout << " -> null" << endl;
+        }
+    }
+};
+
+// ========================================================================
+// 3. CONCURRENT SKIP LIST (LOCK-FREE INSERTION)
+// ========================================================================
+
+/*
+ * THEORY: Lock-Free Skip List Insertion
+ *
+ * Without deletion a concurrent skip list needs no marked pointers:
+ * 1. Find the predecessor and successor at every level.
+ * 2. Fill the new node's links with the successors, then publish it with
+ *    a CAS on the level-0 predecessor. If the CAS fails another thread
+ *    changed that link: search again (and stop if the key now exists).
+ * 3. Link each higher level the same way, bottom-up. The node is already
+ *    in the set once level 0 succeeds; higher levels are only shortcuts.
+ *
+ * Readers never block: they follow acquire loads, and a node is reachable
+ * at level i only after its link at level i was written (release CAS).
+ *
+ * Nodes come from a shared arena: a chunk's bump offset is claimed with
+ * fetch_add, and only switching to a fresh 1 MB chunk takes a mutex. A
+ * node that loses a race to a duplicate stays in the arena unused until
+ * the list is destroyed. Erase and rank queries are intentionally left to
+ * the single-threaded SkipList.
+ */
+
+template<typename Key, typename Compare = less<Key>>
+class ConcurrentSkipList {
+public:
+    static const int MAX_LEVEL = 32;
+
+private:
+    struct Node {
+        Key key;
+        int height;
+        atomic<Node*> next[1];
+    };
+
+    struct Chunk {
+        static const size_t SIZE = 1 << 20;
+        alignas(64) char data[SIZE];
+        atomic<size_t> used{0};
+    };
+
+    vector<unique_ptr<Chunk>> chunks;
+    atomic<Chunk*> currentChunk;
+    mutex chunkMutex;
+
+    Node* head;
+    atomic<int> maxHeight{1};
+    atomic<size_t> count{0};
+    Compare less;
+
+    void* allocate(size_t bytes) {
+        const size_t align = alignof(max_align_t);
+        bytes = (bytes + align - 1) / align * align;
+        while (true) {
+            Chunk* chunk = currentChunk.load(memory_order_acquire);
+            size_t offset = chunk->used.fetch_add(bytes, memory_order_relaxed);
+            if (offset + bytes <= Chunk::SIZE) return chunk->data + offset;
+
+            lock_guard<mutex> lock(chunkMutex);
+            if (currentChunk.load(memory_order_relaxed) == chunk) {
+                chunks.emplace_back(new Chunk);
+                currentChunk.store(chunks.back().get(), memory_order_release);
+            }
+        }
+    }
+
+    Node* newNode(const Key& key, int height) {
+        Node* node = static_cast<Node*>(allocate(offsetof(Node, next) + height * sizeof(atomic<Node*>)));
+        new (&node->key) Key(key);
+        node->height = height;
+        for (int i = 0; i < height; i++) new (&node->next[i]) atomic<Node*>(nullptr);
+        return node;
+    }
+
+    static int randomHeight() {
+        static thread_local uint64_t state =
+            hash<thread::id>()(this_thread::get_id()) * 0x9E3779B97F4A7C15ULL | 1;
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        uint64_t bits = state;
+        int height = 1;
+        while (height < MAX_LEVEL && (bits & 3) == 0) {
+            height++;
+            bits >>= 2;
+        }
+        return height;
+    }
+
+    // Predecessor/successor per level; returns true if key is present
+    bool findPath(const Key& key, Node** preds, Node** succs) const {
+        Node* x = head;
+        int top = maxHeight.load(memory_order_acquire);
+        for (int i = MAX_LEVEL - 1; i >= top; i--) {
+            preds[i] = head;
+            succs[i] = head->next[i].load(memory_order_acquire);
+        }
+        for (int i = top - 1; i >= 0; i--) {
+            Node* next = x->next[i].load(memory_order_acquire);
+            while (next && less(next->key, key)) {
+                x = next;
+                next = x->next[i].load(memory_order_acquire);
+            }
+            preds[i] = x;
+            succs[i] = next;
+        }
+        return succs[0] && !less(key, succs[0]->key);
+    }
+
+    Node* findGreaterOrEqual(const Key& key) const {
+        Node* x = head;
+        for (int i = maxHeight.load(memory_order_acquire) - 1; i >= 0; i--) {
+            Node* next = x->next[i].load(memory_order_acquire);
+            while (next && less(next->key, key)) {
+                x = next;
+                next = x->next[i].load(memory_order_acquire);
+            }
+        }
+        return x->next[0].load(memory_order_acquire);
+    }
+
+public:
+    ConcurrentSkipList() {
+        chunks.emplace_back(new Chunk);
+        currentChunk.store(chunks.back().get());
+        head = newNode(Key(), MAX_LEVEL);
+    }
+
+    ~ConcurrentSkipList() {
+        for (Node* x = head; x; x = x->next[0].load(memory_order_relaxed)) x->key.~Key();
+    }
+
+    ConcurrentSkipList(const ConcurrentSkipList&) = delete;
+    ConcurrentSkipList& operator=(const ConcurrentSkipList&) = delete;
+
+    // Lock-free: some thread always completes its CAS
+    bool insert(const Key& key) {
+        Node* preds[MAX_LEVEL];
+        Node* succs[MAX_LEVEL];
+        if (findPath(key, preds, succs)) return false;
+
+        int height = randomHeight();
+        Node* node = newNode(key, height);
+        int top = maxHeight.load(memory_order_relaxed);
+        while (height > top && !maxHeight.compare_exchange_weak(top, height, memory_order_acq_rel)) {}
+
+        // Level 0 decides membership
+        while (true) {
+            node->next[0].store(succs[0], memory_order_relaxed);
+            if (preds[0]->next[0].compare_exchange_strong(succs[0], node, memory_order_release,
+                                                         memory_order_relaxed)) {
+                break;
+            }
+            if (findPath(key, preds, succs)) {
+                node->key.~Key();  // Lost to a concurrent insert of the same key
+                return false;
+            }
+        }
+
+        for (int i = 1; i < height; i++) {
+            while (true) {
+                node->next[i].store(succs[i], memory_order_relaxed);
+                if (preds[i]->next[i].compare_exchange_strong(succs[i], node, memory_order_release,
+                                                             memory_order_relaxed)) {
+                    break;
+                }
+                findPath(key, preds, succs);
+            }
+        }
+        count.fetch_add(1, memory_order_relaxed);
+        return true;
+    }
+
+    // Wait-free for readers
+    bool contains(const Key& key) const {
+        Node* node = findGreaterOrEqual(key);
+        return node && !less(key, node->key);
+    }
+
+    // Pointer to the first key not less than key, or nullptr
+    const Key* lowerBound(const Key& key) const {
+        Node* node = findGreaterOrEqual(key);
+        return node ? &node->key : nullptr;
+    }
+
+    template<typename Fn>
+    void forEachInRange(const Key& low, const Key& high, Fn fn) const {
+        for (Node* x = findGreaterOrEqual(low); x && less(x->key, high); x = x->next[0].load(memory_order_acquire)) {
+            fn(x->key);
+        }
+    }
+
+    size_t size() const { return count.load(memory_order_relaxed); }
+
+    vector<Key> toVector() const {
+        vector<Key> result;
+        for (Node* x = head->next[0].load(memory_order_acquire); x; x = x->next[0].load(memory_order_acquire)) {
+            result.push_back(x->key);
+        }
+        return result;
+    }
+};
+
+// ========================================================================
+// 4. BENCHMARKS
+// ========================================================================
+
+template<typename Fn>
+double timeMs(Fn&& fn) {
+    auto start = chrono::steady_clock::now();
+    fn();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+void benchmarkSkipList() {
+    cout << "\n=== SKIP LIST BENCHMARK ===" << endl;
+    const int N = 1000000;
+
+    mt19937_64 gen(11);
+    vector<long long> randomKeys(N), streamKeys(N);
+    for (auto& k : randomKeys) k = static_cast<long long>(gen() >> 1);
+    // Timestamps arriving slightly out of order, as in a streaming index
+    for (int i = 0; i < N; i++) streamKeys[i] = i * 16LL + static_cast<long long>(gen() % 64);
+
+    cout << fixed << setprecision(1);
+    cout << N << " keys (ms):" << endl;
+    cout << left << setw(26) << "" << right << setw(12) << "insert" << setw(12) << "find" << setw(12) << "erase" << endl;
+
+    auto runSkipList = [&](const vector<long long>& keys, bool fingerOn, const char* name) {
+        SkipList<long long> list;
+        list.setFingerSearch(fingerOn);
+        size_t found = 0;
+        double insertTime = timeMs([&] { for (long long k : keys) list.insert(k); });
+        double findTime = timeMs([&] { for (long long k : keys) found += list.contains(k); });
+        double eraseTime = timeMs([&] { for (long long k : keys) list.erase(k); });
+        cout << left << setw(26) << name << right << setw(12) << insertTime << setw(12) << findTime
+             << setw(12) << eraseTime << (found == keys.size() && list.empty() ? "" : "  MISMATCH") << endl;
+    };
+    auto runSet = [&](const vector<long long>& keys, const char* name) {
+        set<long long> s;
+        size_t found = 0;
+        double insertTime = timeMs([&] { for (long long k : keys) s.insert(k); });
+        double findTime = timeMs([&] { for (long long k : keys) found += s.count(k); });
+        double eraseTime = timeMs([&] { for (long long k : keys) s.erase(k); });
+        cout << left << setw(26) << name << right << setw(12) << insertTime << setw(12) << findTime
+             << setw(12) << eraseTime << (found == keys.size() && s.empty() ? "" : "  MISMATCH") << endl;
+    };
+
+    runSkipList(randomKeys, false, "SkipList random, no finger");
+    runSkipList(randomKeys, true, "SkipList random, finger");
+    runSet(randomKeys, "std::set random");
+    runSkipList(streamKeys, false, "SkipList stream, no finger");
+    runSkipList(streamKeys, true, "SkipList stream, finger");
+    runSet(streamKeys, "std::set stream");
+
+    // Rank/select and range counting, where std::set would need O(n) distance()
+    SkipList<long long> index;
+    for (long long k : streamKeys) index.insert(k);
+    size_t checksum = 0;
+    double rankTime = timeMs([&] {
+        for (int i = 0; i < N; i += 10) checksum += index.rank(randomKeys[i] % (N * 16LL));
+    });
+    double selectTime = timeMs([&] {
+        for (int i = 0; i < N; i += 10) checksum += index.select(randomKeys[i] % index.size()) & 1;
+    });
+    cout << "100000 rank queries: " << rankTime << " ms, 100000 select queries: " << selectTime << " ms" << endl;
+    cout << "Arena: " << index.bytesReserved() / (1 << 20) << " MB reserved for " << index.size() << " keys" << endl;
+    cout << defaultfloat << setprecision(6);
+    if (checksum == 0) cout << "(empty checksum)" << endl;
+}
+
+void benchmarkConcurrentSkipList() {
+    cout << "\n=== CONCURRENT SKIP LIST BENCHMARK ===" << endl;
+    const int N = 400000;
+
+    mt19937_64 gen(5);
+    vector<long long> keys(N);
+    for (auto& k : keys) k = static_cast<long long>(gen() >> 1);
+    size_t distinct = set<long long>(keys.begin(), keys.end()).size();
+
+    cout << fixed << setprecision(1);
+    cout << N << " inserts split across threads (ms), hardware threads: " << thread::hardware_concurrency() << endl;
+    for (int threads : {1, 2, 4}) {
+        auto split = [&](auto&& insertOne) {
+            vector<thread> workers;
+            for (int t = 0; t < threads; t++) {
+                workers.emplace_back([&, t] {
+                    for (int i = t; i < N; i += threads) insertOne(keys[i]);
+                });
+            }
+            for (auto& w : workers) w.join();
+        };
+
+        ConcurrentSkipList<long long> lockFree;
+        double lockFreeTime = timeMs([&] { split([&](long long k) { lockFree.insert(k); }); });
+
+        SkipList<long long> locked;
+        mutex lock;
+        double lockedTime = timeMs([&] {
+            split([&](long long k) {
+                lock_guard<mutex> guard(lock);
+                locked.insert(k);
+            });
+        });
+
+        vector<long long> expected = lockFree.toVector();
+        bool ok = lockFree.size() == distinct && expected == locked.toVector()
+                  && is_sorted(expected.begin(), expected.end());
+        cout << "  " << threads << " threads: lock-free " << setw(8) << lockFreeTime
+             << ", mutex + SkipList " << setw(8) << lockedTime << (ok ? "" : "  MISMATCH") << endl;
+    }
+    cout << defaultfloat << setprecision(6);
+}
+
+// ========================================================================
+// 5. DEMONSTRATION AND TESTING
+// ========================================================================
+
+void demonstrateSkipList() {
+    cout << "\n=== SKIP LIST OPERATIONS ===" << endl;
+
+    SkipList<int> list(16);
+    for (int x : {30, 10, 50, 20, 40, 60, 70, 5, 25, 35}) list.insert(x);
+    list.display();
+
+    cout << "Size: " << list.size() << endl;
+    cout << "Contains 25: " << (list.contains(25) ? "Yes" : "No") << endl;
+    cout << "Contains 26: " << (list.contains(26) ? "Yes" : "No") << endl;
+    cout << "Insert duplicate 30: " << (list.insert(30) ? "inserted" : "rejected") << endl;
+
+    auto it = list.lowerBound(36);
+    cout << "lowerBound(36): " << (it.valid() ? to_string(it.key()) : "end") << endl;
+    cout << "rank(40) (keys < 40): " << list.rank(40) << endl;
+    cout << "select(3) (4th smallest): " << list.select(3) << endl;
+
+    cout << "Range [20, 50): ";
+    list.forEachInRange(20, 50, [](int x) { cout << x << " "; });
+    cout << "(" << list.countInRange(20, 50) << " keys)" << endl;
+
+    list.erase(30);
+    list.erase(5);
+    cout << "After erasing 30 and 5: ";
+    for (auto i = list.begin(); i.valid(); i.next()) cout << i.key() << " ";
+    cout << endl;
+
+    // Randomized cross-check against std::set, with and without the finger
+    for (bool finger : {false, true}) {
+        SkipList<int> checked(7);
+        checked.setFingerSearch(finger);
+        set<int> reference;
+        mt19937 gen(3);
+        bool ok = true;
+        for (int op = 0; op < 200000 && ok; op++) {
+            int key = gen() % 5000;
+            switch (gen() % 4) {
+                case 0: ok = checked.insert(key) == reference.insert(key).second; break;
+                case 1: ok = checked.erase(key) == (reference.erase(key) == 1); break;
+                case 2: ok = checked.rank(key) == static_cast<size_t>(distance(reference.begin(), reference.lower_bound(key)));
+                        break;
+                default: {
+                    auto expected = reference.lower_bound(key);
+                    auto actual = checked.lowerBound(key);
+                    ok = actual.valid() == (expected != reference.end()) && (!actual.valid() || actual.key() == *expected);
+                    if (ok && !reference.empty()) {
+                        size_t k = gen() % reference.size();
+                        ok = checked.select(k) == *next(reference.begin(), k);
+                    }
+                }
+            }
+        }
+        ok = ok && checked.toVector() == vector<int>(reference.begin(), reference.end());
+        cout << "200000 random operations match std::set (finger " << (finger ? "on" : "off") << "): "
+             << (ok ? "Yes" : "No") << endl;
+    }
+
+    benchmarkSkipList();
+}
+
+void demonstrateConcurrentSkipList() {
+    cout << "\n=== CONCURRENT SKIP LIST ===" << endl;
+
+    ConcurrentSkipList<int> list;
+    vector<thread> writers;
+    for (int t = 0; t < 4; t++) {
+        // Overlapping ranges so threads race on the same keys
+        writers.emplace_back([&list, t] {
+            for (int i = 0; i < 1000; i++) list.insert((i * 7 + t * 250) % 2000);
+        });
+    }
+    for (auto& w : writers) w.join();
+
+    vector<int> keys = list.toVector();
+    cout << "4 writers, overlapping keys: " << list.size() << " distinct keys, sorted: "
+         << (is_sorted(keys.begin(), keys.end()) && adjacent_find(keys.begin(), keys.end()) == keys.end() ? "Yes" : "No")
+         << endl;
+    const int* bound = list.lowerBound(1995);
+    cout << "lowerBound(1995): " << (bound ? to_string(*bound) : "end") << endl;
+    cout << "Range [100, 110): ";
+    list.forEachInRange(100, 110, [](int x) { cout << x << " "; });
+    cout << endl;
+
+    benchmarkConcurrentSkipList();
+}
+
+int main() {
+    cout << "SKIP LIST - ORDERED CONTAINER BUILT FROM LINKED LISTS" << endl;
+    cout << "=====================================================" << endl;
+
+    try {
+        demonstrateSkipList();
+        demonstrateConcurrentSkipList();
+
+        cout << "\n=== SUMMARY ===" << endl;
+        cout << "✓ Arena node pool with inline level arrays" << endl;
+        cout << "✓ Ordered insert, erase, lower_bound and range iteration" << endl;
+        cout << "✓ Rank and select queries via link spans" << endl;
+        cout << "✓ Finger search for streaming inserts" << endl;
+        cout << "✓ Concurrent skip list with lock-free insertion" << endl;
+
+    } catch (const exception& e) {
+        cerr << "Error: " << e.what() << endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+/*
+ * COMPILATION AND EXECUTION:
+ *
+ * To compile: g++ -std=c++17 -O2 -pthread -o skip_list skip_list.cpp
+ * To run: ./skip_list
+ *
+ * TIME COMPLEXITY SUMMARY (expected, p = 1/4):
+ * - Insert / erase / contains / lowerBound: O(log n)
+ * - With a finger d positions behind the key: O(log d)
+ * - rank / select / countInRange: O(log n)
+ * - forEachInRange: O(log n + k) for k reported keys
+ * - Concurrent insert: O(log n) plus retries under contention
+ *
+ * SPACE COMPLEXITY:
+ * - 4/3 links per node on average (each link is a pointer + span)
+ * - Arena chunks of 64 KB (1 MB for the concurrent list)
+ *
+ * NEXT STEPS:
+ * 1. Add logical deletion with marked pointers to the concurrent list
+ * 2. Compare with B-trees for disk-resident indexes
+ * 3. Study how LevelDB/RocksDB use skip lists as memtables
+ */
@@ -29,6 +29,15 @@
 #include <string>
 #include <functional>
 #include <climits>
+#include <unordered_set>
+#include <deque>
+#include <chrono>
+#include <iomanip>
+#include <array>
+#include <cmath>
+#include <numeric>
+#include <thread>
+#include <stdexcept>
 
 using namespace std;
 
@@ -850,6 +859,484 @@ public:
     }
 };
 
+/*
+ * ========================================================================
+ * PROBLEM 9: SLIDING WINDOW AGGREGATE ENGINE (VAN HERK / GIL-WERMAN)
+ * ========================================================================
+ * 
+ * Problem 4 answers one full vector<int> at a time, and the deque version
+ * does data-dependent pops (unpredictable branches). The van Herk /
+ * Gil-Werman scheme splits the input into blocks of k elements:
+ * 
+ *   P[i] = op of block start .. i       (prefix inside the block)
+ *   S[i] = op of i .. block end         (suffix inside the block)
+ *   window [i, i+k-1] = op(S[i], P[i+k-1])
+ * 
+ * That is 3 applications of op per element no matter how large k is,
+ * with no branches on the data, and the final combine pass is a plain
+ * element-wise loop the compiler vectorizes. It only needs op to be
+ * associative (max, min, sum, gcd, bitwise and/or, matrix product...):
+ * when a window is exactly one block, S[i] alone is the answer, so
+ * nothing is counted twice even for non-idempotent ops.
+ * 
+ * The streaming form keeps just the suffix array of the previous block
+ * and the running prefix of the current one (O(k) memory), so chunks can
+ * be fed as they arrive.
+ * 
+ * Time: O(n) for any k, Space: O(n) batch / O(k) streaming
+ */
+
+template<typename T, typename Op>
+class SlidingWindowAggregate {
+public:
+    // Batch: out[i] = op over data[i .. i+k-1] for every full window
+    static vector<T> compute(const vector<T>& data, int k, Op op = Op()) {
+        int n = data.size();
+        if (k <= 0) throw invalid_argument("Window size must be positive");
+        if (k > n) return {};
+        
+        vector<T> prefix(n), suffix(n);
+        for (int blockStart = 0; blockStart < n; blockStart += k) {
+            int blockEnd = min(blockStart + k, n) - 1;
+            prefix[blockStart] = data[blockStart];
+            for (int i = blockStart + 1; i <= blockEnd; ++i) prefix[i] = op(prefix[i - 1], data[i]);
+            suffix[blockEnd] = data[blockEnd];
+            for (int i = blockEnd - 1; i >= blockStart; --i) suffix[i] = op(data[i], suffix[i + 1]);
+        }
+        
+        // Windows starting on a block boundary are exactly one block
+        vector<T> result(n - k + 1);
+        for (int blockStart = 0; blockStart + k <= n; blockStart += k) {
+            result[blockStart] = suffix[blockStart];
+            int last = min(blockStart + k - 1, n - k);
+            for (int i = blockStart + 1; i <= last; ++i) result[i] = op(suffix[i], prefix[i + k - 1]);
+        }
+        return result;
+    }
+};
+
+template<typename T, typename Op>
+class StreamingWindowAggregate {
+private:
+    int k;
+    Op op;
+    vector<T> block;          // Raw values of the block being filled
+    vector<T> prevSuffix;     // Suffix aggregates of the previous full block
+    T prefix{};
+    long long seen = 0;
+    
+public:
+    explicit StreamingWindowAggregate(int windowSize, Op operation = Op())
+        : k(windowSize), op(operation) {
+        if (k <= 0) throw invalid_argument("Window size must be positive");
+        block.reserve(k);
+        prevSuffix.resize(k);
+    }
+    
+    // Push one value; returns true and sets `window` once a full window ends here
+    bool push(const T& value, T& window) {
+        int pos = block.size();
+        prefix = (pos == 0) ? value : op(prefix, value);
+        block.push_back(value);
+        ++seen;
+        
+        bool ready = seen >= k;
+        if (pos == k - 1) {
+            window = prefix;  // The window is exactly this block
+            prevSuffix[k - 1] = block[k - 1];
+            for (int i = k - 2; i >= 0; --i) prevSuffix[i] = op(block[i], prevSuffix[i + 1]);
+            block.clear();
+        } else if (ready) {
+            window = op(prevSuffix[pos + 1], prefix);
+        }
+        return ready;
+    }
+    
+    // Feed a chunk of the stream, appending completed windows to `out`
+    void feed(const T* chunk, size_t count, vector<T>& out) {
+        T window;
+        for (size_t i = 0; i < count; ++i) {
+            if (push(chunk[i], window)) out.push_back(window);
+        }
+    }
+};
+
+struct MaxOp {
+    int operator()(int a, int b) const { return a > b ? a : b; }
+};
+
+struct MinOp {
+    int operator()(int a, int b) const { return a < b ? a : b; }
+};
+
+struct SumOp {
+    long long operator()(long long a, long long b) const { return a + b; }
+};
+
+// Associative but not commutative: catches any operand swapped in a combine
+struct ConcatOp {
+    string operator()(const string& a, const string& b) const { return a + b; }
+};
+
+// Seeded comparison of both engines with a naive left-to-right window fold,
+// using string concatenation so operand order matters
+bool checkWindowAggregates(unsigned seed, int cases) {
+    unsigned state = seed;
+    auto next = [&](unsigned bound) {
+        state = state * 1664525 + 1013904223;
+        return (state >> 8) % bound;
+    };
+    
+    for (int c = 0; c < cases; ++c) {
+        vector<string> data(next(40));
+        for (string& s : data) {
+            s.clear();
+            for (unsigned len = 1 + next(3); len > 0; --len) s += static_cast<char>('a' + next(26));
+        }
+        int n = data.size();
+        int k = 1 + next(n + 2);
+        
+        vector<string> expected;
+        for (int i = 0; i + k <= n; ++i) {
+            string window = data[i];
+            for (int j = i + 1; j < i + k; ++j) window = ConcatOp()(window, data[j]);
+            expected.push_back(window);
+        }
+        
+        StreamingWindowAggregate<string, ConcatOp> stream(k);
+        vector<string> streamed;
+        for (int i = 0; i < n;) {
+            int len = min<int>(1 + next(7), n - i);
+            stream.feed(data.data() + i, len, streamed);
+            i += len;
+        }
+        if (SlidingWindowAggregate<string, ConcatOp>::compute(data, k) != expected || streamed != expected) {
+            return false;
+        }
+    }
+    
+    // Non-positive window sizes are rejected by both forms
+    int rejected = 0;
+    try { SlidingWindowAggregate<int, MaxOp>::compute({1, 2}, 0); } catch (const invalid_argument&) { ++rejected; }
+    try { StreamingWindowAggregate<int, MaxOp> bad(-1); } catch (const invalid_argument&) { ++rejected; }
+    return rejected == 2;
+}
+
+void benchmarkSlidingWindowMaximum() {
+    const int N = 200000;
+    vector<int> nums(N);
+    unsigned seed = 42;
+    for (int& x : nums) {
+        seed = seed * 1664525 + 1013904223;
+        x = static_cast<int>(seed >> 8) % 1000000;
+    }
+    
+    Solution_SlidingWindowMaximum sol;
+    cout << "Sliding window maximum over " << N << " values (ms):" << endl;
+    cout << setw(8) << "k" << setw(12) << "BruteForce" << setw(10) << "Deque" << setw(10) << "MaxHeap"
+         << setw(10) << "SegTree" << setw(10) << "VanHerk" << setw(11) << "Streaming" << endl;
+    
+    for (int k : {16, 256, 4096}) {
+        vector<int> expected = sol.maxSlidingWindow_Deque(nums, k);
+        bool allMatch = true;
+        auto timeIt = [&](auto&& fn) {
+            auto start = chrono::steady_clock::now();
+            vector<int> got = fn();
+            double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+            allMatch = allMatch && got == expected;
+            return ms;
+        };
+        
+        cout << setw(8) << k << fixed << setprecision(2);
+        if (k <= 256) {
+            cout << setw(12) << timeIt([&] { return sol.maxSlidingWindow_BruteForce(nums, k); });
+        } else {
+            cout << setw(12) << "skipped";
+        }
+        cout << setw(10) << timeIt([&] { return sol.maxSlidingWindow_Deque(nums, k); })
+             << setw(10) << timeIt([&] { return sol.maxSlidingWindow_MaxHeap(nums, k); })
+             << setw(10) << timeIt([&] { return sol.maxSlidingWindow_SegmentTree(nums, k); })
+             << setw(10) << timeIt([&] { return SlidingWindowAggregate<int, MaxOp>::compute(nums, k); })
+             << setw(11) << timeIt([&] {
+                    // Stream the input in 4096-value chunks
+                    StreamingWindowAggregate<int, MaxOp> stream(k);
+                    vector<int> out;
+                    for (size_t i = 0; i < nums.size(); i += 4096) {
+                        stream.feed(nums.data() + i, min<size_t>(4096, nums.size() - i), out);
+                    }
+                    return out;
+                })
+             << (allMatch ? "" : "  MISMATCH") << endl;
+        cout << defaultfloat << setprecision(6);
+    }
+}
+
+/*
+ * ========================================================================
+ * PROBLEM 10: SELECTION ENGINE (FLOYD-RIVEST / INTROSELECT)
+ * ========================================================================
+ * 
+ * The quickselects in Problems 1 and 3 always pivot on the last element:
+ * sorted or all-equal input makes every partition peel off one element,
+ * so they run in O(n²) with O(n) recursion depth, and they reorder the
+ * caller's array.
+ * 
+ * This engine:
+ * - Picks pivots with Floyd-Rivest sampling: recursively select from a
+ *   small window around k so that the pivot lands just next to the
+ *   target rank. Most of the array is discarded in the first pass
+ *   (about n + min(k, n-k) comparisons on random input).
+ * - Partitions three ways (< pivot, == pivot, > pivot) with a
+ *   branchless Lomuto loop: an unconditional swap and an index bump by
+ *   the comparison result, so duplicates cannot stall progress and the
+ *   loop has no data-dependent branch to mispredict.
+ * - Falls back to median-of-medians pivots (introselect) after repeated
+ *   bad splits, which bounds the worst case at O(n).
+ * - Partitions very large ranges in parallel: per-chunk counts, then
+ *   every chunk scatters into its private slots of the three regions.
+ * - Answers several ranks in one call (p50/p90/p99): select the middle
+ *   rank, then recurse into each side with the ranks that fall there,
+ *   O(n log m) for m ranks instead of m full passes.
+ * 
+ * The value-returning API works on a copy; the in-place API reorders
+ * like nth_element (everything before k is <=, everything after is >=).
+ */
+
+template<typename T, typename Compare = less<T>>
+class SelectionEngine {
+public:
+    static constexpr size_t SMALL = 24;
+    static constexpr size_t SAMPLE_THRESHOLD = 600;
+    static constexpr size_t PARALLEL_THRESHOLD = 1 << 20;
+    static constexpr int BAD_SPLIT_LIMIT = 4;
+    
+    explicit SelectionEngine(size_t threads = 1, Compare comp = Compare())
+        : threads(max<size_t>(1, threads)), comp(comp) {}
+    
+    // In place: data[k] becomes the element of rank k; throws if k >= size
+    void selectInPlace(vector<T>& data, size_t k) const {
+        if (k >= data.size()) throw out_of_range("Rank out of range");
+        select(data.data(), 0, data.size(), k, false);
+    }
+    
+    // In place: every rank in ks ends up at its sorted position; throws if
+    // any rank is >= size
+    void multiSelectInPlace(vector<T>& data, vector<size_t> ks) const {
+        sort(ks.begin(), ks.end());
+        ks.erase(unique(ks.begin(), ks.end()), ks.end());
+        if (!ks.empty() && ks.back() >= data.size()) throw out_of_range("Rank out of range");
+        multiSelect(data.data(), 0, data.size(), ks.data(), ks.data() + ks.size());
+    }
+    
+    T nth(vector<T> data, size_t k) const {
+        selectInPlace(data, k);
+        return data[k];
+    }
+    
+    vector<T> nthMany(vector<T> data, const vector<size_t>& ks) const {
+        multiSelectInPlace(data, ks);
+        vector<T> result;
+        for (size_t k : ks) result.push_back(data[k]);
+        return result;
+    }
+    
+    // Nearest-rank percentiles: p in [0, 1] maps to rank round(p * (n - 1))
+    vector<T> percentiles(vector<T> data, const vector<double>& ps) const {
+        if (data.empty()) return {};
+        vector<size_t> ks;
+        for (double p : ps) ks.push_back(static_cast<size_t>(min(max(p, 0.0), 1.0) * (data.size() - 1) + 0.5));
+        return nthMany(move(data), ks);
+    }
+
+private:
+    size_t threads;
+    Compare comp;
+    
+    void insertionSort(T* a, size_t lo, size_t hi) const {
+        for (size_t i = lo + 1; i < hi; ++i) {
+            T value = a[i];
+            size_t j = i;
+            for (; j > lo && comp(value, a[j - 1]); --j) a[j] = a[j - 1];
+            a[j] = value;
+        }
+    }
+    
+    // Branchless Lomuto: moves elements with pred(x) to the front of [lo, hi)
+    template<typename Pred>
+    static size_t partitionBranchless(T* a, size_t lo, size_t hi, Pred pred) {
+        size_t i = lo;
+        for (size_t j = lo; j < hi; ++j) {
+            T value = a[j];
+            bool moveLeft = pred(value);
+            a[j] = a[i];
+            a[i] = value;
+            i += moveLeft;
+        }
+        return i;
+    }
+    
+    // Rearranges [lo, hi) into < pivot, == pivot, > pivot; returns the bounds of ==
+    pair<size_t, size_t> partition3(T* a, size_t lo, size_t hi, const T& pivot) const {
+        if (threads > 1 && hi - lo >= PARALLEL_THRESHOLD) return parallelPartition3(a, lo, hi, pivot);
+        size_t lessEnd = partitionBranchless(a, lo, hi, [&](const T& x) { return comp(x, pivot); });
+        size_t equalEnd = partitionBranchless(a, lessEnd, hi, [&](const T& x) { return !comp(pivot, x); });
+        return {lessEnd, equalEnd};
+    }
+    
+    pair<size_t, size_t> parallelPartition3(T* a, size_t lo, size_t hi, const T& pivot) const {
+        size_t n = hi - lo;
+        size_t chunks = threads;
+        auto chunkBegin = [&](size_t c) { return lo + n * c / chunks; };
+        auto classOf = [&](const T& x) { return comp(x, pivot) ? 0 : (comp(pivot, x) ? 2 : 1); };
+        vector<array<size_t, 3>> counts(chunks, array<size_t, 3>{0, 0, 0});
+        
+        auto runChunks = [&](auto&& fn) {
+            vector<thread> workers;
+            for (size_t c = 0; c < chunks; ++c) workers.emplace_back(fn, c);
+            for (auto& w : workers) w.join();
+        };
+        runChunks([&](size_t c) {
+            for (size_t i = chunkBegin(c); i < chunkBegin(c + 1); ++i) ++counts[c][classOf(a[i])];
+        });
+        
+        // Chunk c writes its class-r elements to cursor[c][r] onward
+        size_t totals[3] = {0, 0, 0};
+        for (const auto& c : counts) for (int r = 0; r < 3; ++r) totals[r] += c[r];
+        size_t regionStart[3] = {0, totals[0], totals[0] + totals[1]};
+        vector<array<size_t, 3>> cursor(chunks);
+        for (int r = 0; r < 3; ++r) {
+            size_t running = regionStart[r];
+            for (size_t c = 0; c < chunks; ++c) {
+                cursor[c][r] = running;
+                running += counts[c][r];
+            }
+        }
+        
+        vector<T> buffer(n);
+        runChunks([&](size_t c) {
+            for (size_t i = chunkBegin(c); i < chunkBegin(c + 1); ++i) buffer[cursor[c][classOf(a[i])]++] = a[i];
+        });
+        runChunks([&](size_t c) {
+            for (size_t i = chunkBegin(c); i < chunkBegin(c + 1); ++i) a[i] = buffer[i - lo];
+        });
+        return {lo + totals[0], lo + totals[0] + totals[1]};
+    }
+    
+    // Median of the medians of groups of 5, guaranteeing a 30/70 split
+    T medianOfMedians(T* a, size_t lo, size_t hi) const {
+        size_t groups = 0;
+        for (size_t g = lo; g < hi; g += 5) {
+            size_t end = min(g + 5, hi);
+            insertionSort(a, g, end);
+            swap(a[lo + groups++], a[g + (end - g) / 2]);
+        }
+        size_t mid = lo + groups / 2;
+        select(a, lo, lo + groups, mid, true);
+        return a[mid];
+    }
+    
+    void select(T* a, size_t lo, size_t hi, size_t k, bool forceMedianOfMedians) const {
+        int badSplits = forceMedianOfMedians ? BAD_SPLIT_LIMIT : 0;
+        while (hi - lo > SMALL) {
+            size_t size = hi - lo;
+            T pivot;
+            if (badSplits >= BAD_SPLIT_LIMIT) {
+                pivot = medianOfMedians(a, lo, hi);
+            } else {
+                if (size > SAMPLE_THRESHOLD) {
+                    // Floyd-Rivest: recursively place rank k of a window sized ~n^(2/3) around k
+                    double n = static_cast<double>(size);
+                    double i = static_cast<double>(k - lo + 1);
+                    double z = log(n);
+                    double s = 0.5 * exp(2.0 * z / 3.0);
+                    double sd = 0.5 * sqrt(z * s * (n - s) / n) * (i < n / 2 ? -1.0 : 1.0);
+                    double windowLo = static_cast<double>(k) - i * s / n + sd;
+                    double windowHi = static_cast<double>(k) + (n - i) * s / n + sd;
+                    size_t newLo = static_cast<size_t>(max(static_cast<double>(lo), windowLo));
+                    size_t newHi = static_cast<size_t>(min(static_cast<double>(hi - 1), windowHi)) + 1;
+                    if (newLo <= k && k < newHi) select(a, newLo, newHi, k, false);
+                }
+                pivot = a[k];
+            }
+            
+            auto [lessEnd, equalEnd] = partition3(a, lo, hi, pivot);
+            if (k < lessEnd) {
+                hi = lessEnd;
+            } else if (k >= equalEnd) {
+                lo = equalEnd;
+            } else {
+                return;
+            }
+            if (hi - lo > size - size / 8) ++badSplits;
+        }
+        insertionSort(a, lo, hi);
+    }
+    
+    void multiSelect(T* a, size_t lo, size_t hi, const size_t* kFirst, const size_t* kLast) const {
+        if (kFirst == kLast || hi - lo <= 1) return;
+        const size_t* mid = kFirst + (kLast - kFirst) / 2;
+        select(a, lo, hi, *mid, false);
+        multiSelect(a, lo, *mid, kFirst, mid);
+        multiSelect(a, *mid + 1, hi, mid + 1, kLast);
+    }
+};
+
+void benchmarkSelection() {
+    auto timeIt = [](auto&& fn) {
+        auto start = chrono::steady_clock::now();
+        fn();
+        return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    };
+    size_t threads = max(1u, thread::hardware_concurrency());
+    cout << fixed << setprecision(2);
+    
+    // Adversarial inputs for the fixed-pivot quickselect of Problem 1
+    const int SMALL_N = 20000;
+    vector<int> sorted(SMALL_N), equal(SMALL_N, 7);
+    iota(sorted.begin(), sorted.end(), 0);
+    Solution_KthLargest kth;
+    SelectionEngine<int> engine;
+    cout << "Median of " << SMALL_N << " values (ms):" << endl;
+    for (auto* input : {&sorted, &equal}) {
+        int expected = 0, got = 0;
+        double lomuto = timeIt([&] { auto copy = *input; expected = kth.findKthLargest_QuickSelect(copy, SMALL_N / 2); });
+        double fr = timeIt([&] { got = engine.nth(*input, SMALL_N - SMALL_N / 2); });
+        cout << "  " << (input == &sorted ? "sorted:   " : "all equal:") << " fixed-pivot quickselect " << lomuto
+             << ", SelectionEngine " << fr << (expected == got ? "" : "  MISMATCH") << endl;
+    }
+    
+    const size_t N = 1 << 24;
+    vector<int> data(N);
+    unsigned seed = 7;
+    for (int& x : data) {
+        seed = seed * 1664525 + 1013904223;
+        x = static_cast<int>(seed >> 1);
+    }
+    SelectionEngine<int> parallel(threads);
+    int expected = 0, seq = 0, par = 0;
+    double stl = timeIt([&] { auto copy = data; nth_element(copy.begin(), copy.begin() + N / 2, copy.end()); expected = copy[N / 2]; });
+    double one = timeIt([&] { seq = engine.nth(data, N / 2); });
+    double many = timeIt([&] { par = parallel.nth(data, N / 2); });
+    cout << "Median of " << N << " random values (ms, including the copy):" << endl;
+    cout << "  nth_element " << stl << ", SelectionEngine " << one << ", parallel (" << threads << " threads) " << many
+         << (expected == seq && seq == par ? "" : "  MISMATCH") << endl;
+    
+    vector<double> ps = {0.5, 0.9, 0.99};
+    vector<int> viaStl, viaEngine;
+    double stl3 = timeIt([&] {
+        auto copy = data;
+        for (double p : ps) {
+            size_t k = static_cast<size_t>(p * (N - 1) + 0.5);
+            nth_element(copy.begin(), copy.begin() + k, copy.end());
+            viaStl.push_back(copy[k]);
+        }
+    });
+    double multi = timeIt([&] { viaEngine = engine.percentiles(data, ps); });
+    cout << "p50/p90/p99: 3x nth_element " << stl3 << ", one multi-select " << multi
+         << (viaStl == viaEngine ? "" : "  MISMATCH") << endl;
+    cout << defaultfloat << setprecision(6);
+}
+
 /*
  * ========================================================================
  * TESTING AND DEMONSTRATION
@@ -937,6 +1424,60 @@ void testHeapProblems() {
         cout << "\nCooling time: " << n << endl;
         cout << "Minimum time: " << sol.leastInterval(tasks, n) << endl;
     }
+    
+    // Test Sliding Window Aggregate Engine
+    {
+        cout << "\n--- Sliding Window Aggregate Engine ---" << endl;
+        vector<int> nums = {1,3,-1,-3,5,3,6,7};
+        
+        cout << "Window max (k=3): ";
+        for (int x : SlidingWindowAggregate<int, MaxOp>::compute(nums, 3)) cout << x << " ";
+        cout << "\nWindow min (k=3): ";
+        for (int x : SlidingWindowAggregate<int, MinOp>::compute(nums, 3)) cout << x << " ";
+        
+        vector<long long> wide(nums.begin(), nums.end());
+        StreamingWindowAggregate<long long, SumOp> sums(3);
+        vector<long long> out;
+        sums.feed(wide.data(), 5, out);       // Two chunks: 5 + 3 values
+        sums.feed(wide.data() + 5, 3, out);
+        cout << "\nStreaming window sum (k=3, chunks 5+3): ";
+        for (long long x : out) cout << x << " ";
+        cout << endl;
+        cout << "String concatenation windows vs naive fold (500 seeded cases): "
+             << (checkWindowAggregates(85, 500) ? "matches" : "MISMATCH") << endl;
+        
+        benchmarkSlidingWindowMaximum();
+    }
+    
+    // Test Selection Engine
+    {
+        cout << "\n--- Selection Engine ---" << endl;
+        vector<int> nums = {3,2,3,1,2,4,5,5,6};
+        SelectionEngine<int> engine;
+        SelectionEngine<int, greater<int>> descending;
+        
+        cout << "4th largest: " << descending.nth(nums, 3) << endl;
+        cout << "Median: " << engine.nth(nums, nums.size() / 2) << endl;
+        cout << "p0/p50/p100: ";
+        for (int x : engine.percentiles(nums, {0.0, 0.5, 1.0})) cout << x << " ";
+        cout << "\nInput left unchanged: ";
+        for (int x : nums) cout << x << " ";
+        cout << endl;
+        
+        int rejected = 0;
+        vector<int> empty, copy = nums;
+        auto expectOutOfRange = [&](auto&& call) {
+            try { call(); } catch (const out_of_range&) { rejected++; }
+        };
+        expectOutOfRange([&] { engine.nth(empty, 0); });
+        expectOutOfRange([&] { engine.nth(nums, nums.size()); });
+        expectOutOfRange([&] { engine.nthMany(nums, {0, nums.size() + 5}); });
+        expectOutOfRange([&] { engine.selectInPlace(copy, copy.size()); });
+        expectOutOfRange([&] { engine.multiSelectInPlace(copy, {1, copy.size()}); });
+        cout << "Out-of-range ranks rejected: " << rejected << "/5" << endl;
+        
+        benchmarkSelection();
+    }
 }
 
 /*
@@ -979,6 +1520,12 @@ int main() {
  *    - Deque: O(n) time, O(k) space
  *    - Max Heap: O(n log k) time, O(k) space
  *    - Brute Force: O(n * k) time, O(1) space
+ *    - Van Herk / Gil-Werman: O(n) time, 3 ops per element, O(k) streaming
+ * 
+ * 10. SELECTION ENGINE:
+ *    - Floyd-Rivest: n + min(k, n-k) + o(n) comparisons expected
+ *    - Median-of-medians fallback: O(n) worst case
+ *    - Multi-select of m ranks: O(n log m) time
  * 
  * 5. MEDIAN FROM DATA STREAM:
  *    - Two Heaps: O(log n) insert, O(1) median, O(n) space
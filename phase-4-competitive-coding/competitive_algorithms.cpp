@@ -22,6 +22,20 @@
 #include <climits>
 #include <cmath>
 #include <bitset>
+#include <deque>
+#include <functional>
+#include <thread>
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <random>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define COMBO_SIMD_X86 1
+#else
+#define COMBO_SIMD_X86 0
+#endif
 using namespace std;
 
 // ===============================================================
@@ -729,6 +743,363 @@ public:
     }
 };
 
+// ===============================================================
+// COMBINATORIAL GENERATORS (LAZY, SINGLE REUSABLE BUFFER)
+// ===============================================================
+
+/*
+ * BitUtils::generateSubsets materializes all 2^n subsets as separate
+ * vectors and NextPermutation rescans for the pivot one int at a time.
+ * These generators instead mutate ONE buffer in place:
+ *
+ *   gen.current()  -> the buffer (valid until the next call to next())
+ *   gen.next()     -> advance; false once the sequence is exhausted
+ *   gen.seek(rank) -> jump straight to the rank-th element (unrank)
+ *
+ * Because seek() is O(n) or O(k), a range [0, count) can be split across
+ * threads: each thread seeks to its first rank and iterates its share.
+ * Compile with -pthread.
+ */
+
+class PermutationScan {
+public:
+    // Largest i with a[i] < a[i + 1], or -1 when a is non-increasing
+    static long long findPivot(const int* a, size_t n) {
+        if (n < 2) return -1;
+        size_t i = n - 1;  // Pairs (i - 1, i) are checked from the right
+#if COMBO_SIMD_X86
+        static const bool hasAVX2 = __builtin_cpu_supports("avx2");
+        if (hasAVX2) return findPivotAVX2(a, n);
+#endif
+        while (i > 0 && a[i - 1] >= a[i]) --i;
+        return static_cast<long long>(i) - 1;
+    }
+
+    // std::next_permutation with the pivot found by findPivot
+    static bool nextPermutation(int* a, size_t n) {
+        long long pivot = findPivot(a, n);
+        if (pivot < 0) {
+            reverse(a, a + n);
+            return false;
+        }
+        // The suffix is non-increasing: binary search the rightmost element > a[pivot]
+        int* suffixBegin = a + pivot + 1;
+        int* successor = lower_bound(suffixBegin, a + n, a[pivot], greater<int>()) - 1;
+        swap(a[pivot], *successor);
+        reverse(suffixBegin, a + n);
+        return true;
+    }
+
+private:
+#if COMBO_SIMD_X86
+    __attribute__((target("avx2")))
+    static long long findPivotAVX2(const int* a, size_t n) {
+        // Most pivots sit near the end: try a few pairs before going wide
+        size_t i = n - 1;
+        for (int step = 0; step < 8 && i > 0; ++step, --i) {
+            if (a[i - 1] < a[i]) return static_cast<long long>(i) - 1;
+        }
+        // Compare a[j..j+7] < a[j+1..j+8] for blocks ending at i
+        while (i >= 8) {
+            size_t j = i - 8;
+            __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + j));
+            __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + j + 1));
+            unsigned mask = static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(hi, lo))));
+            if (mask) return static_cast<long long>(j + 31 - __builtin_clz(mask));
+            i = j;
+        }
+        while (i > 0 && a[i - 1] >= a[i]) --i;
+        return static_cast<long long>(i) - 1;
+    }
+#endif
+};
+
+// Lexicographic permutations; count() and seek() assume distinct items
+class PermutationGenerator {
+private:
+    vector<int> items;     // Sorted copy of the input
+    vector<int> buffer;
+    bool exhausted = false;
+
+public:
+    explicit PermutationGenerator(vector<int> values) : items(move(values)) {
+        sort(items.begin(), items.end());
+        buffer = items;
+    }
+
+    const vector<int>& current() const { return buffer; }
+
+    bool next() {
+        if (exhausted) return false;
+        exhausted = !PermutationScan::nextPermutation(buffer.data(), buffer.size());
+        return !exhausted;
+    }
+
+    // n!; throws for n > 20, where it no longer fits in 64 bits
+    unsigned long long count() const {
+        if (items.size() > 20) throw overflow_error("More than 20! permutations");
+        unsigned long long total = 1;
+        for (size_t i = 2; i <= items.size(); ++i) total *= i;
+        return total;
+    }
+
+    // Unrank through the factorial number system
+    void seek(unsigned long long rank) {
+        vector<int> pool = items;
+        unsigned long long block = count();
+        exhausted = rank >= block;
+        for (size_t i = 0; i < buffer.size() && !exhausted; ++i) {
+            block /= (items.size() - i);
+            size_t pick = static_cast<size_t>(rank / block);
+            rank %= block;
+            buffer[i] = pool[pick];
+            pool.erase(pool.begin() + pick);
+        }
+    }
+};
+
+// Heap's algorithm: every step is a single swap (not lexicographic)
+class HeapPermutationGenerator {
+private:
+    vector<int> buffer;
+    vector<size_t> counters;
+    size_t level = 1;
+
+public:
+    explicit HeapPermutationGenerator(vector<int> values)
+        : buffer(move(values)), counters(buffer.size(), 0) {}
+
+    const vector<int>& current() const { return buffer; }
+
+    bool next() {
+        while (level < buffer.size()) {
+            if (counters[level] < level) {
+                swap(buffer[level % 2 == 0 ? 0 : counters[level]], buffer[level]);
+                ++counters[level];
+                level = 1;
+                return true;
+            }
+            counters[level] = 0;
+            ++level;
+        }
+        return false;
+    }
+};
+
+/*
+ * k-combinations of n <= 64 items with Gosper's hack: the next mask with
+ * the same popcount is  t = m | (m - 1);  m' = (t + 1) | (((~t & -~t) - 1) >> (ctz(m) + 1)).
+ * Masks increase numerically (colex order), which is what seek() unranks.
+ */
+class CombinationGenerator {
+private:
+    vector<int> items;
+    vector<int> buffer;
+    size_t k;
+    uint64_t mask = 0;
+    uint64_t limit;       // First mask with a bit at position n
+
+    void fill() {
+        size_t out = 0;
+        for (uint64_t m = mask; m; m &= m - 1) buffer[out++] = items[__builtin_ctzll(m)];
+    }
+
+    // Each step is C(n - r + i, i), so the division is exact; the product
+    // before it needs 128 bits near n = 64 (C(64, 32) is just under 2^61)
+    static unsigned long long choose(size_t n, size_t r) {
+        if (r > n) return 0;
+        unsigned __int128 result = 1;
+        for (size_t i = 1; i <= r; ++i) result = result * (n - r + i) / i;
+        return static_cast<unsigned long long>(result);
+    }
+
+public:
+    CombinationGenerator(vector<int> values, size_t k)
+        : items(move(values)), buffer(k), k(k),
+          limit(items.size() >= 64 ? 0 : uint64_t(1) << items.size()) {
+        if (items.size() > 64) throw invalid_argument("At most 64 items fit in a mask");
+        seek(0);
+    }
+
+    const vector<int>& current() const { return buffer; }
+
+    bool next() {
+        if (k == 0 || mask == 0) {
+            mask = 0;
+            return false;
+        }
+        uint64_t t = mask | (mask - 1);
+        uint64_t nextMask = (t + 1) | (((~t & (t + 1)) - 1) >> (__builtin_ctzll(mask) + 1));
+        // Overflow past bit 63 wraps to a smaller value; otherwise compare against n
+        if (nextMask <= mask || (limit != 0 && nextMask >= limit)) {
+            mask = 0;
+            return false;
+        }
+        mask = nextMask;
+        fill();
+        return true;
+    }
+
+    unsigned long long count() const { return choose(items.size(), k); }
+
+    // Combinatorial number system: rank = sum C(c_i, i) over chosen positions
+    void seek(unsigned long long rank) {
+        mask = 0;
+        if (k > items.size() || rank >= count()) return;
+        for (size_t i = k; i >= 1; --i) {
+            size_t c = i - 1;
+            while (choose(c + 1, i) <= rank) ++c;
+            rank -= choose(c, i);
+            mask |= uint64_t(1) << c;
+        }
+        fill();
+    }
+};
+
+// Subsets of n <= 63 items in mask order; rank == mask
+class SubsetGenerator {
+private:
+    vector<int> items;
+    vector<int> buffer;
+    uint64_t mask = 0;
+
+public:
+    explicit SubsetGenerator(vector<int> values) : items(move(values)) {
+        if (items.size() > 63) throw invalid_argument("At most 63 items fit in a mask with a count");
+        buffer.reserve(items.size());
+    }
+
+    const vector<int>& current() const { return buffer; }
+
+    bool next() {
+        if (mask + 1 >= count()) return false;
+        seek(mask + 1);
+        return true;
+    }
+
+    unsigned long long count() const { return 1ULL << items.size(); }
+
+    void seek(unsigned long long rank) {
+        mask = rank;
+        buffer.clear();
+        for (uint64_t m = mask; m; m &= m - 1) buffer.push_back(items[__builtin_ctzll(m)]);
+    }
+};
+
+// Range adapter: for (const vector<int>& combo : GeneratorRange<CombinationGenerator>(gen)) ...
+template <typename Generator>
+class GeneratorRange {
+private:
+    Generator& gen;
+
+public:
+    explicit GeneratorRange(Generator& g) : gen(g) {}
+
+    class iterator {
+    private:
+        Generator* gen;
+    public:
+        explicit iterator(Generator* g) : gen(g) {}
+        const vector<int>& operator*() const { return gen->current(); }
+        iterator& operator++() {
+            if (!gen->next()) gen = nullptr;
+            return *this;
+        }
+        bool operator!=(const iterator& other) const { return gen != other.gen; }
+    };
+
+    iterator begin() { return iterator(&gen); }
+    iterator end() { return iterator(nullptr); }
+};
+
+/*
+ * Split ranks [0, gen.count()) across threads. Each worker gets its own
+ * generator copy (and thus its own buffer), seeks to the start of its
+ * share, and calls visit(threadIndex, buffer) for every element.
+ */
+template <typename Generator, typename Visit>
+void forEachInParallel(const Generator& prototype, unsigned threads, Visit visit) {
+    unsigned long long total = prototype.count();
+    threads = static_cast<unsigned>(max(1ULL, min<unsigned long long>(threads, total)));
+    vector<thread> workers;
+    for (unsigned t = 0; t < threads; ++t) {
+        unsigned long long begin = total * t / threads, end = total * (t + 1) / threads;
+        workers.emplace_back([&prototype, &visit, t, begin, end] {
+            Generator gen = prototype;
+            gen.seek(begin);
+            for (unsigned long long r = begin; r < end; ++r) {
+                visit(t, gen.current());
+                if (r + 1 < end) gen.next();
+            }
+        });
+    }
+    for (auto& w : workers) w.join();
+}
+
+// seek(i) must land where i calls to next() from seek(0) do
+template <typename Generator>
+bool seekMatchesNext(Generator gen) {
+    Generator stepped = gen;
+    stepped.seek(0);
+    for (unsigned long long rank = 0; rank < gen.count(); ++rank) {
+        gen.seek(rank);
+        if (gen.current() != stepped.current()) return false;
+        if (stepped.next() != (rank + 1 < gen.count())) return false;
+    }
+    return true;
+}
+
+/*
+ * Seeded checks:
+ * - nextPermutation against std::next_permutation on n = 9..200 with many
+ *   duplicates and long non-increasing suffixes, so the pivot sits far
+ *   from the end and the AVX2 block loop runs
+ * - seek(i) against i x next() for permutations, combinations, subsets
+ * - C(64, k) counts and colex seek/next at n = 64, and rejected sizes
+ */
+bool checkCombinatorialGenerators(unsigned seed, int cases) {
+    mt19937 gen(seed);
+    bool ok = true;
+    for (int c = 0; c < cases && ok; ++c) {
+        size_t n = 9 + gen() % 192;
+        vector<int> a(n);
+        for (int& x : a) x = static_cast<int>(gen() % 6);
+        size_t suffix = gen() % n;
+        sort(a.end() - suffix, a.end(), greater<int>());
+        vector<int> expected = a;
+        for (int step = 0; step < 4 && ok; ++step) {
+            bool more = next_permutation(expected.begin(), expected.end());
+            ok = PermutationScan::nextPermutation(a.data(), n) == more && a == expected;
+        }
+    }
+    
+    ok = ok && seekMatchesNext(PermutationGenerator({4, 1, 7, 3, 9, 2}));
+    ok = ok && seekMatchesNext(CombinationGenerator({1, 2, 3, 4, 5, 6, 7, 8, 9, 10}, 4));
+    ok = ok && seekMatchesNext(CombinationGenerator({1, 2, 3}, 0));
+    ok = ok && seekMatchesNext(SubsetGenerator({1, 2, 3, 4, 5, 6, 7}));
+    
+    vector<int> wide(64);
+    for (int i = 0; i < 64; ++i) wide[i] = i;
+    CombinationGenerator half(wide, 32);
+    ok = ok && half.count() == 1832624140942590534ULL;
+    ok = ok && CombinationGenerator(wide, 63).count() == 64 && CombinationGenerator(wide, 1).count() == 64;
+    for (int c = 0; c < cases && ok; ++c) {
+        unsigned long long rank = (static_cast<unsigned long long>(gen()) << 32 | gen()) % (half.count() - 1);
+        CombinationGenerator stepped = half;
+        stepped.seek(rank);
+        half.seek(rank + 1);
+        ok = stepped.next() && stepped.current() == half.current();
+    }
+    half.seek(half.count() - 1);
+    ok = ok && half.current().front() == 32 && !half.next();
+    
+    int rejected = 0;
+    try { CombinationGenerator(vector<int>(65), 2); } catch (const invalid_argument&) { rejected++; }
+    try { SubsetGenerator(vector<int>(64)); } catch (const invalid_argument&) { rejected++; }
+    try { PermutationGenerator(vector<int>(21)).count(); } catch (const overflow_error&) { rejected++; }
+    return ok && rejected == 3;
+}
+
 // ===============================================================
 // TESTING AND DEMONSTRATION
 // ===============================================================
@@ -780,6 +1151,34 @@ void demonstrateAlgorithms() {
     cout << "Set bits in 15: " << bitUtils.countSetBits(15) << "\n";
     cout << "Is 16 power of 2: " << bitUtils.isPowerOfTwo(16) << "\n";
     
+    // Test lazy combinatorial generators
+    CombinationGenerator combos({1, 2, 3, 4, 5}, 3);
+    cout << "3-combinations of {1..5} (Gosper's hack):";
+    for (const vector<int>& combo : GeneratorRange<CombinationGenerator>(combos)) {
+        cout << " {" << combo[0] << combo[1] << combo[2] << "}";
+    }
+    cout << "\n";
+    
+    PermutationGenerator perms({1, 2, 3, 4, 5, 6, 7, 8});
+    atomic<unsigned long long> visited{0}, checksum{0};
+    forEachInParallel(perms, 4, [&](unsigned, const vector<int>& perm) {
+        visited++;
+        checksum += perm[0] * 10 + perm[7];
+    });
+    cout << "Permutations of 8 visited by 4 threads: " << visited << " (checksum " << checksum << ")\n";
+    
+    SubsetGenerator subsets({1, 2, 3, 4});
+    int subsetCount = 0;
+    size_t elementTotal = 0;
+    for (const vector<int>& subset : GeneratorRange<SubsetGenerator>(subsets)) {
+        subsetCount++;
+        elementTotal += subset.size();
+    }
+    cout << "Subsets of 4 items generated in one buffer: " << subsetCount
+         << " (" << elementTotal << " elements total)\n";
+    cout << "Generators match std::next_permutation and seek(): "
+         << (checkCombinatorialGenerators(83, 300) ? "Yes" : "No") << "\n";
+    
     cout << "\n=== All algorithms demonstrated successfully! ===\n";
 }
 